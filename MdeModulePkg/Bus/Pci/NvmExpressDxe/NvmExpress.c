@@ -654,19 +654,20 @@ NvmExpressDriverBindingStart (
     }
 
     //
-    // 4 x 4kB aligned buffers will be carved out of this buffer.
+    // NVME_BUFFER_PAGES x 4kB aligned buffers will be carved out of this buffer.
     // 1st 4kB boundary is the start of the admin submission queue.
     // 2nd 4kB boundary is the start of the admin completion queue.
     // 3rd 4kB boundary is the start of I/O submission queue #1.
     // 4th 4kB boundary is the start of I/O completion queue #1.
+    // The remaining pages are the preallocated PRP lists.
     //
-    // Allocate 4 pages of memory, then map it for bus master read and write.
+    // Allocate NVME_BUFFER_PAGES pages of memory, then map it for bus master read and write.
     //
     Status = PciIo->AllocateBuffer (
                       PciIo,
                       AllocateAnyPages,
                       EfiBootServicesData,
-                      4,
+                      NVME_BUFFER_PAGES,
                       (VOID**)&Private->Buffer,
                       0
                       );
@@ -674,7 +675,7 @@ NvmExpressDriverBindingStart (
       goto Exit2;
     }
 
-    Bytes = EFI_PAGES_TO_SIZE (4);
+    Bytes = EFI_PAGES_TO_SIZE (NVME_BUFFER_PAGES);
     Status = PciIo->Map (
                       PciIo,
                       EfiPciIoOperationBusMasterCommonBuffer,
@@ -684,12 +685,12 @@ NvmExpressDriverBindingStart (
                       &Private->Mapping
                       );
 
-    if (EFI_ERROR (Status) || (Bytes != EFI_PAGES_TO_SIZE (4))) {
+    if (EFI_ERROR (Status) || (Bytes != EFI_PAGES_TO_SIZE (NVME_BUFFER_PAGES))) {
       goto Exit2;
     }
 
     Private->BufferPciAddr = (UINT8 *)(UINTN)MappedAddr;
-    ZeroMem (Private->Buffer, EFI_PAGES_TO_SIZE (4));
+    ZeroMem (Private->Buffer, EFI_PAGES_TO_SIZE (NVME_BUFFER_PAGES));
 
     Private->Signature = NVME_CONTROLLER_PRIVATE_DATA_SIGNATURE;
     Private->ControllerHandle          = Controller;
@@ -778,7 +779,7 @@ Exit2:
   }
 
   if ((Private != NULL) && (Private->Buffer != NULL)) {
-    PciIo->FreeBuffer (PciIo, 4, Private->Buffer);
+    PciIo->FreeBuffer (PciIo, NVME_BUFFER_PAGES, Private->Buffer);
   }
 
   if (Private != NULL) {
@@ -868,7 +869,7 @@ NvmExpressDriverBindingStop (
       }
 
       if (Private->Buffer != NULL) {
-        Private->PciIo->FreeBuffer (Private->PciIo, 4, Private->Buffer);
+        Private->PciIo->FreeBuffer (Private->PciIo, NVME_BUFFER_PAGES, Private->Buffer);
       }
 
       FreePool (Private->ControllerData);
@@ -64,6 +64,9 @@ extern EFI_DRIVER_SUPPORTED_EFI_VERSION_PROTOCOL  gNvmExpressDriverSupportedEfiV
 
 #define NVME_MAX_IO_QUEUES                        2     // Number of I/O queues supported by the driver
 
+#define NVME_PRP_LIST_PAGES                       4     // Number of preallocated PRP list pages
+#define NVME_BUFFER_PAGES                         (4 + NVME_PRP_LIST_PAGES)
+
 #define NVME_CONTROLLER_ID                        0
 
 //
@@ -100,13 +103,12 @@ struct _NVME_CONTROLLER_PRIVATE_DATA {
   NVME_ADMIN_CONTROLLER_DATA      *ControllerData;
 
   //
-  // 6 x 4kB aligned buffers will be carved out of this buffer.
+  // NVME_BUFFER_PAGES x 4kB aligned buffers will be carved out of this buffer.
   // 1st 4kB boundary is the start of the admin submission queue.
-  // 2nd 4kB boundary is the start of submission queue #1.
-  // 3rd 4kB boundary is the start of the admin completion queue.
-  // 4th 4kB boundary is the start of completion queue #1.
-  // 5th 4kB boundary is the start of the first PRP list page.
-  // 6th 4kB boundary is the start of the second PRP list page.
+  // 2nd 4kB boundary is the start of the admin completion queue.
+  // 3rd 4kB boundary is the start of I/O submission queue #1.
+  // 4th 4kB boundary is the start of I/O completion queue #1.
+  // The remaining NVME_PRP_LIST_PAGES pages hold the PRP lists of transfers.
   //
   UINT8                           *Buffer;
   UINT8                           *BufferPciAddr;
@@ -134,6 +136,13 @@ struct _NVME_CONTROLLER_PRIVATE_DATA {
   NVME_CAP                        Cap;
 
   VOID                            *Mapping;
+
+  //
+  // Preallocated PRP lists, reused by every command whose transfer fits
+  // in NVME_PRP_LIST_PAGES pages of PRP entries.
+  //
+  UINT64                          *PrpList;
+  UINT64                          *PrpListPciAddr;
 };
 
 #define NVME_CONTROLLER_PRIVATE_DATA_FROM_PASS_THRU(a) \
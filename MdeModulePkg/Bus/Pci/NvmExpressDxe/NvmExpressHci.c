@@ -889,6 +889,12 @@ NvmeControllerInit (
   Private->CqBuffer[1]        = (NVME_CQ *)(UINTN)(Private->Buffer + 3 * EFI_PAGE_SIZE);
   Private->CqBufferPciAddr[1] = (NVME_CQ *)(UINTN)(Private->BufferPciAddr + 3 * EFI_PAGE_SIZE);
 
+  //
+  // Address of the preallocated PRP lists.
+  //
+  Private->PrpList            = (UINT64 *)(UINTN)(Private->Buffer + 4 * EFI_PAGE_SIZE);
+  Private->PrpListPciAddr     = (UINT64 *)(UINTN)(Private->BufferPciAddr + 4 * EFI_PAGE_SIZE);
+
   DEBUG ((EFI_D_INFO, "Private->Buffer = [%016X]\n", (UINT64)(UINTN)Private->Buffer));
   DEBUG ((EFI_D_INFO, "Admin Submission Queue size (Aqa.Asqs) = [%08X]\n", Aqa.Asqs));
   DEBUG ((EFI_D_INFO, "Admin Completion Queue size (Aqa.Acqs) = [%08X]\n", Aqa.Acqs));
@@ -215,6 +215,72 @@ NvmeDumpStatus (
   }
 }
 
+/**
+  Calculate the number of PRP list pages needed to describe a data transfer.
+
+  The last entry of every PRP list page except the last one points to the
+  next PRP list page, so each of those pages describes one page less.
+
+  @param[in]     Pages               The number of pages to be transfered.
+
+  @return The number of PRP list pages.
+
+**/
+UINTN
+NvmeGetPrpListNo (
+  IN     UINTN                        Pages
+  )
+{
+  UINTN                       PrpEntryNo;
+
+  //
+  // The number of Prp Entry in a memory page.
+  //
+  PrpEntryNo = EFI_PAGE_SIZE / sizeof (UINT64);
+
+  if (Pages <= PrpEntryNo) {
+    return 1;
+  }
+
+  return (Pages - 2) / (PrpEntryNo - 1) + 1;
+}
+
+/**
+  Fill PRP lists with the pages of a data transfer.
+
+  @param[in]     PrpListHost         The host base address of PRP lists.
+  @param[in]     PrpListPhyAddr      The bus master address of PRP lists.
+  @param[in]     PhysicalAddr        The physical base address of data buffer.
+  @param[in]     Pages               The number of pages to be transfered.
+
+**/
+VOID
+NvmeFillPrpList (
+  IN     UINT64                       *PrpListHost,
+  IN     EFI_PHYSICAL_ADDRESS         PrpListPhyAddr,
+  IN     EFI_PHYSICAL_ADDRESS         PhysicalAddr,
+  IN     UINTN                        Pages
+  )
+{
+  UINTN                       PrpEntryNo;
+  UINTN                       PrpEntryIndex;
+
+  PrpEntryNo = EFI_PAGE_SIZE / sizeof (UINT64);
+
+  for (PrpEntryIndex = 0; Pages > 0; ++PrpEntryIndex) {
+    if ((PrpEntryIndex % PrpEntryNo == PrpEntryNo - 1) && (Pages > 1)) {
+      //
+      // Fill last PRP entry of a full PRP list with next PRP List pointer.
+      //
+      PrpListHost[PrpEntryIndex] = PrpListPhyAddr + (PrpEntryIndex + 1) * sizeof (UINT64);
+    } else {
+      PrpListHost[PrpEntryIndex] = PhysicalAddr;
+      PhysicalAddr += EFI_PAGE_SIZE;
+      Pages--;
+    }
+  }
+}
+
 /**
   Create PRP lists for data transfer which is larger than 2 memory pages.
   Note here we calcuate the number of required PRP lists and allocate them at one time.
@@ -239,27 +305,14 @@ NvmeCreatePrpList (
      OUT VOID                         **Mapping
   )
 {
-  UINTN                       PrpEntryNo;
-  UINT64                      PrpListBase;
-  UINTN                       PrpListIndex;
-  UINTN                       PrpEntryIndex;
-  UINT64                      Remainder;
   EFI_PHYSICAL_ADDRESS        PrpListPhyAddr;
   UINTN                       Bytes;
   EFI_STATUS                  Status;
 
-  //
-  // The number of Prp Entry in a memory page.
-  //
-  PrpEntryNo = EFI_PAGE_SIZE / sizeof (UINT64);
-
   //
   // Calculate total PrpList number.
   //
-  *PrpListNo = (UINTN)DivU64x64Remainder ((UINT64)Pages, (UINT64)PrpEntryNo, &Remainder);
-  if (Remainder != 0) {
-    *PrpListNo += 1;
-  }
+  *PrpListNo = NvmeGetPrpListNo (Pages);
 
   Status = PciIo->AllocateBuffer (
                     PciIo,
@@ -288,36 +341,9 @@ NvmeCreatePrpList (
     DEBUG ((EFI_D_ERROR, "NvmeCreatePrpList: create PrpList failure!\n"));
     goto EXIT;
   }
-  //
-  // Fill all PRP lists except of last one.
-  //
+
   ZeroMem (*PrpListHost, Bytes);
-  for (PrpListIndex = 0; PrpListIndex < *PrpListNo - 1; ++PrpListIndex) {
-    PrpListBase = *(UINT8*)PrpListHost + PrpListIndex * EFI_PAGE_SIZE;
-
-    for (PrpEntryIndex = 0; PrpEntryIndex < PrpEntryNo; ++PrpEntryIndex) {
-      if (PrpEntryIndex != PrpEntryNo - 1) {
-        //
-        // Fill all PRP entries except of last one.
-        //
-        *((UINT64*)(UINTN)PrpListBase + PrpEntryIndex) = PhysicalAddr;
-        PhysicalAddr += EFI_PAGE_SIZE;
-      } else {
-        //
-        // Fill last PRP entries with next PRP List pointer.
-        //
-        *((UINT64*)(UINTN)PrpListBase + PrpEntryIndex) = PrpListPhyAddr + (PrpListIndex + 1) * EFI_PAGE_SIZE;
-      }
-    }
-  }
-  //
-  // Fill last PRP list.
-  //
-  PrpListBase = *(UINT64*)PrpListHost + PrpListIndex * EFI_PAGE_SIZE;
-  for (PrpEntryIndex = 0; PrpEntryIndex < ((Remainder != 0) ? Remainder : PrpEntryNo); ++PrpEntryIndex) {
-    *((UINT64*)(UINTN)PrpListBase + PrpEntryIndex) = PhysicalAddr;
-    PhysicalAddr += EFI_PAGE_SIZE;
-  }
+  NvmeFillPrpList ((UINT64 *)*PrpListHost, PrpListPhyAddr, PhysicalAddr, Pages);
 
   return (VOID*)(UINTN)PrpListPhyAddr;
 
@@ -388,6 +414,7 @@ NvmExpressPassThru (
   UINT64                        *Prp;
   VOID                          *PrpListHost;
   UINTN                         PrpListNo;
+  UINTN                         Pages;
   UINT32                        Data;
 
   //
@@ -503,12 +530,21 @@ NvmExpressPassThru (
     // Create PrpList for remaining data buffer.
     //
     PhyAddr = (Sq->Prp[0] + EFI_PAGE_SIZE) & ~(EFI_PAGE_SIZE - 1);
-    Prp = NvmeCreatePrpList (PciIo, PhyAddr, EFI_SIZE_TO_PAGES(Offset + Bytes) - 1, &PrpListHost, &PrpListNo, &MapPrpList);
-    if (Prp == NULL) {
-      goto EXIT;
-    }
+    Pages   = EFI_SIZE_TO_PAGES(Offset + Bytes) - 1;
+    if (NvmeGetPrpListNo (Pages) <= NVME_PRP_LIST_PAGES) {
+      //
+      // Use the preallocated PRP lists, which are already mapped for bus master access.
+      //
+      NvmeFillPrpList (Private->PrpList, (EFI_PHYSICAL_ADDRESS)(UINTN)Private->PrpListPciAddr, PhyAddr, Pages);
+      Sq->Prp[1] = (UINT64)(UINTN)Private->PrpListPciAddr;
+    } else {
+      Prp = NvmeCreatePrpList (PciIo, PhyAddr, Pages, &PrpListHost, &PrpListNo, &MapPrpList);
+      if (Prp == NULL) {
+        goto EXIT;
+      }
 
-    Sq->Prp[1] = (UINT64)(UINTN)Prp;
+      Sq->Prp[1] = (UINT64)(UINTN)Prp;
+    }
   } else if ((Offset + Bytes) > EFI_PAGE_SIZE) {
     Sq->Prp[1] = (Sq->Prp[0] + EFI_PAGE_SIZE) & ~(EFI_PAGE_SIZE - 1);
   }
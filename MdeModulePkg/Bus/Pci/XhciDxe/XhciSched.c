@@ -1219,6 +1219,7 @@ XhcExecTransfer (
   UINTN                   Loop;
   UINT8                   SlotId;
   UINT8                   Dci;
+  EVENT_RING              *EvtRing;
 
   if (CmdTransfer) {
     SlotId = 0;
@@ -1240,10 +1241,21 @@ XhcExecTransfer (
 
   XhcRingDoorBell (Xhc, SlotId, Dci);
 
+  EvtRing = &Xhc->EventRing;
   for (Index = 0; Index < Loop; Index++) {
-    Status = XhcCheckUrbResult (Xhc, Urb);
-    if (Urb->Finished) {
-      break;
+    //
+    // XhcCheckUrbResult() reads several controller registers, which is costly
+    // compared to the 1us poll interval. Only run it when the event ring holds
+    // an unprocessed event, and once per millisecond so that a halted or failed
+    // controller is still reported promptly.
+    //
+    if ((EvtRing->EventRingDequeue != EvtRing->EventRingEnqueue) ||
+        (EvtRing->EventRingDequeue->CycleBit == EvtRing->EventRingCCS) ||
+        (Index % XHC_1_MILLISECOND == 0)) {
+      Status = XhcCheckUrbResult (Xhc, Urb);
+      if (Urb->Finished) {
+        break;
+      }
     }
     gBS->Stall (XHC_1_MICROSECOND);
   }
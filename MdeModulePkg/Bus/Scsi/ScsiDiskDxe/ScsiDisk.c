@@ -444,6 +444,8 @@ ScsiDiskReset (
 
   ScsiDiskDevice  = SCSI_DISK_DEV_FROM_THIS (This);
 
+  ScsiDiskDevice->MediaDetectDeferred = FALSE;
+
   Status          = ScsiDiskDevice->ScsiIo->ResetDevice (ScsiDiskDevice->ScsiIo);
 
   if (EFI_ERROR (Status)) {
@@ -508,7 +510,7 @@ ScsiDiskReadBlocks (
 
   if (!IS_DEVICE_FIXED(ScsiDiskDevice)) {
 
-    Status = ScsiDiskDetectMedia (ScsiDiskDevice, FALSE, &MediaChange);
+    Status = ScsiDiskDetectMediaForIo (ScsiDiskDevice, &MediaChange);
     if (EFI_ERROR (Status)) {
       Status = EFI_DEVICE_ERROR;
       goto Done;
@@ -578,6 +580,9 @@ ScsiDiskReadBlocks (
   // to transfer data from device to host.
   //
   Status = ScsiDiskReadSectors (ScsiDiskDevice, Buffer, Lba, NumberOfBlocks);
+  if (EFI_ERROR (Status)) {
+    ScsiDiskDevice->MediaDetectDeferred = FALSE;
+  }
 
 Done:
   gBS->RestoreTPL (OldTpl);
@@ -626,7 +631,7 @@ ScsiDiskWriteBlocks (
 
   if (!IS_DEVICE_FIXED(ScsiDiskDevice)) {
 
-    Status = ScsiDiskDetectMedia (ScsiDiskDevice, FALSE, &MediaChange);
+    Status = ScsiDiskDetectMediaForIo (ScsiDiskDevice, &MediaChange);
     if (EFI_ERROR (Status)) {
       Status = EFI_DEVICE_ERROR;
       goto Done;
@@ -695,6 +700,9 @@ ScsiDiskWriteBlocks (
   // to transfer data from device to host.
   //
   Status = ScsiDiskWriteSectors (ScsiDiskDevice, Buffer, Lba, NumberOfBlocks);
+  if (EFI_ERROR (Status)) {
+    ScsiDiskDevice->MediaDetectDeferred = FALSE;
+  }
 
 Done:
   gBS->RestoreTPL (OldTpl);
@@ -723,6 +731,63 @@ ScsiDiskFlushBlocks (
   return EFI_SUCCESS;
 }
 
+/**
+  Detect media changes on a removable device before a read or write.
+
+  Polling the device costs at least one TEST UNIT READY command, which used
+  to be issued in front of every read and write. While media is present, a
+  successful detection is trusted for SCSI_DISK_MEDIA_DETECT_INTERVAL. A
+  media change inside that window is still reported by the device as a unit
+  attention on the next command, which fails the request and forces a new
+  detection on the following one.
+
+  @param  ScsiDiskDevice    The pointer of SCSI_DISK_DEV
+  @param  MediaChange       The pointer of flag indicates if media has changed
+
+  @retval EFI_DEVICE_ERROR  Indicates that error occurs
+  @retval EFI_SUCCESS       Successfully to detect media, or the last detection is still trusted
+
+**/
+EFI_STATUS
+ScsiDiskDetectMediaForIo (
+  IN   SCSI_DISK_DEV   *ScsiDiskDevice,
+  OUT  BOOLEAN         *MediaChange
+  )
+{
+  EFI_STATUS          Status;
+
+  *MediaChange = FALSE;
+
+  if (ScsiDiskDevice->MediaDetectTimer == NULL) {
+    Status = gBS->CreateEvent (
+                    EVT_TIMER,
+                    TPL_CALLBACK,
+                    NULL,
+                    NULL,
+                    &ScsiDiskDevice->MediaDetectTimer
+                    );
+    if (EFI_ERROR (Status)) {
+      ScsiDiskDevice->MediaDetectTimer = NULL;
+    }
+  }
+
+  if (ScsiDiskDevice->MediaDetectDeferred &&
+      (gBS->CheckEvent (ScsiDiskDevice->MediaDetectTimer) == EFI_NOT_READY)) {
+    return EFI_SUCCESS;
+  }
+
+  ScsiDiskDevice->MediaDetectDeferred = FALSE;
+  Status = ScsiDiskDetectMedia (ScsiDiskDevice, FALSE, MediaChange);
+  if (EFI_ERROR (Status) || !ScsiDiskDevice->BlkIo.Media->MediaPresent ||
+      (ScsiDiskDevice->MediaDetectTimer == NULL)) {
+    return Status;
+  }
+
+  if (!EFI_ERROR (gBS->SetTimer (ScsiDiskDevice->MediaDetectTimer, TimerRelative, SCSI_DISK_MEDIA_DETECT_INTERVAL))) {
+    ScsiDiskDevice->MediaDetectDeferred = TRUE;
+  }
+  return Status;
+}
 
 /**
   Detect Device and read out capacity ,if error occurs, parse the sense key.
@@ -2927,6 +2992,11 @@ ReleaseScsiDiskDeviceResources (
     ScsiDiskDevice->ControllerNameTable = NULL;
   }
 
+  if (ScsiDiskDevice->MediaDetectTimer != NULL) {
+    gBS->CloseEvent (ScsiDiskDevice->MediaDetectTimer);
+    ScsiDiskDevice->MediaDetectTimer = NULL;
+  }
+
   FreePool (ScsiDiskDevice);
 
   ScsiDiskDevice = NULL;
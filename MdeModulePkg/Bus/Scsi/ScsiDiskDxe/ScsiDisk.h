@@ -44,6 +44,12 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 
 #define SCSI_DISK_DEV_SIGNATURE SIGNATURE_32 ('s', 'c', 'd', 'k')
 
+//
+// How long a successful media detection on a removable device is trusted
+// before the next read or write polls the device again.
+//
+#define SCSI_DISK_MEDIA_DETECT_INTERVAL  EFI_TIMER_PERIOD_SECONDS (1)
+
 typedef struct {
   UINT32                    Signature;
 
@@ -75,6 +81,13 @@ typedef struct {
   // The flag indicates if 16-byte command can be used
   //
   BOOLEAN                   Cdb16Byte;
+
+  //
+  // Timer that limits how often removable media is polled from the I/O path.
+  // MediaDetectDeferred is TRUE while the last detection can be trusted.
+  //
+  EFI_EVENT                 MediaDetectTimer;
+  BOOLEAN                   MediaDetectDeferred;
 } SCSI_DISK_DEV;
 
 #define SCSI_DISK_DEV_FROM_THIS(a)  CR (a, SCSI_DISK_DEV, BlkIo, SCSI_DISK_DEV_SIGNATURE)
@@ -526,6 +539,22 @@ ScsiDiskDetectMedia (
   OUT  BOOLEAN         *MediaChange
   );
 
+/**
+  Detect media changes on a removable device before a read or write.
+
+  @param  ScsiDiskDevice    The pointer of SCSI_DISK_DEV
+  @param  MediaChange       The pointer of flag indicates if media has changed
+
+  @retval EFI_DEVICE_ERROR  Indicates that error occurs
+  @retval EFI_SUCCESS       Successfully to detect media, or the last detection is still trusted
+
+**/
+EFI_STATUS
+ScsiDiskDetectMediaForIo (
+  IN   SCSI_DISK_DEV   *ScsiDiskDevice,
+  OUT  BOOLEAN         *MediaChange
+  );
+
 /**
   To test device.
 
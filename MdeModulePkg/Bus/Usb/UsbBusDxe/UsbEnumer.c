@@ -655,6 +655,9 @@ UsbFindChild (
 /**
   Enumerate and configure the new device on the port of this HUB interface.
 
+  The caller must have waited USB_WAIT_PORT_STABLE_STALL since the
+  connection on the port was detected, see UsbGetPortsStatus().
+
   @param  HubIf                 The HUB that has the device connected.
   @param  Port                  The port index of the hub (started with zero).
 
@@ -683,8 +686,6 @@ UsbEnumerateNewDev (
   HubApi  = HubIf->HubApi;  
   Address = Bus->MaxDevices;
 
-  gBS->Stall (USB_WAIT_PORT_STABLE_STALL);
-  
   //
   // Hub resets the device for at least 10 milliseconds.
   // Host learns device speed. If device is of low/full speed
@@ -876,6 +877,7 @@ ON_ERROR:
 
   @param  HubIf                 The HUB that has the device connected.
   @param  Port                  The port index of the hub (started with zero).
+  @param  PortState             The port status read by UsbGetPortsStatus().
 
   @retval EFI_SUCCESS           The device is enumerated (added or removed).
   @retval EFI_OUT_OF_RESOURCES  Failed to allocate resource for the device.
@@ -885,37 +887,28 @@ ON_ERROR:
 EFI_STATUS
 UsbEnumeratePort (
   IN USB_INTERFACE        *HubIf,
-  IN UINT8                Port
+  IN UINT8                Port,
+  IN EFI_USB_PORT_STATUS  *PortState
   )
 {
   USB_HUB_API             *HubApi;
   USB_DEVICE              *Child;
-  EFI_USB_PORT_STATUS     PortState;
   EFI_STATUS              Status;
 
   Child   = NULL;
   HubApi  = HubIf->HubApi;
-
-  //
-  // Host learns of the new device by polling the hub for port changes.
-  //
-  Status = HubApi->GetPortStatus (HubIf, Port, &PortState);
-
-  if (EFI_ERROR (Status)) {
-    DEBUG ((EFI_D_ERROR, "UsbEnumeratePort: failed to get state of port %d\n", Port));
-    return Status;
-  }
+  Status  = EFI_SUCCESS;
 
   //
   // Only handle connection/enable/overcurrent/reset change.
   // Usb super speed hub may report other changes, such as warm reset change. Ignore them.
   //
-  if ((PortState.PortChangeStatus & (USB_PORT_STAT_C_CONNECTION | USB_PORT_STAT_C_ENABLE | USB_PORT_STAT_C_OVERCURRENT | USB_PORT_STAT_C_RESET)) == 0) {
+  if ((PortState->PortChangeStatus & (USB_PORT_STAT_C_CONNECTION | USB_PORT_STAT_C_ENABLE | USB_PORT_STAT_C_OVERCURRENT | USB_PORT_STAT_C_RESET)) == 0) {
     return EFI_SUCCESS;
   }
 
   DEBUG (( EFI_D_INFO, "UsbEnumeratePort: port %d state - %02x, change - %02x on %p\n",
-              Port, PortState.PortStatus, PortState.PortChangeStatus, HubIf));
+              Port, PortState->PortStatus, PortState->PortChangeStatus, HubIf));
 
   //
   // This driver only process two kinds of events now: over current and
@@ -923,9 +916,9 @@ UsbEnumeratePort (
   // ENABLE/RESET is used to reset port. SUSPEND isn't supported.
   //
   
-  if (USB_BIT_IS_SET (PortState.PortChangeStatus, USB_PORT_STAT_C_OVERCURRENT)) {     
+  if (USB_BIT_IS_SET (PortState->PortChangeStatus, USB_PORT_STAT_C_OVERCURRENT)) {     
 
-    if (USB_BIT_IS_SET (PortState.PortStatus, USB_PORT_STAT_OVERCURRENT)) {
+    if (USB_BIT_IS_SET (PortState->PortStatus, USB_PORT_STAT_OVERCURRENT)) {
       //
       // Case1:
       //   Both OverCurrent and OverCurrentChange set, means over current occurs, 
@@ -945,7 +938,7 @@ UsbEnumeratePort (
     DEBUG (( EFI_D_ERROR, "UsbEnumeratePort: 2.0 device Recovery Over Current\n", Port)); 
   }
 
-  if (USB_BIT_IS_SET (PortState.PortChangeStatus, USB_PORT_STAT_C_ENABLE)) {  
+  if (USB_BIT_IS_SET (PortState->PortChangeStatus, USB_PORT_STAT_C_ENABLE)) {  
     //
     // Case3:
     //   1.1 roothub port reg doesn't reflect over-current state, while its counterpart
@@ -955,7 +948,7 @@ UsbEnumeratePort (
     DEBUG (( EFI_D_ERROR, "UsbEnumeratePort: 1.1 device Recovery Over Current\n", Port));
   }
   
-  if (USB_BIT_IS_SET (PortState.PortChangeStatus, USB_PORT_STAT_C_CONNECTION)) {
+  if (USB_BIT_IS_SET (PortState->PortChangeStatus, USB_PORT_STAT_C_CONNECTION)) {
     //
     // Case4:
     //   Device connected or disconnected normally. 
@@ -973,12 +966,14 @@ UsbEnumeratePort (
     UsbRemoveDevice (Child);
   }
   
-  if (USB_BIT_IS_SET (PortState.PortStatus, USB_PORT_STAT_CONNECTION)) {
+  if (USB_BIT_IS_SET (PortState->PortStatus, USB_PORT_STAT_CONNECTION)) {
     //
     // Now, new device connected, enumerate and configure the device 
     //
     DEBUG (( EFI_D_INFO, "UsbEnumeratePort: new device connected at port %d\n", Port));
+    PERF_START (HubIf->Device->Bus->HostHandle, "UsbEnum:", NULL, 0);
     Status = UsbEnumerateNewDev (HubIf, Port);
+    PERF_END (HubIf->Device->Bus->HostHandle, "UsbEnum:", NULL, 0);
   
   } else {
     DEBUG (( EFI_D_INFO, "UsbEnumeratePort: device disconnected event on port %d\n", Port));
@@ -989,6 +984,71 @@ UsbEnumeratePort (
 }
 
 
+/**
+  Read the status of the hub ports about to be enumerated.
+
+  The status of each port is read only once, because reading it may clear
+  the change bits it reports. Every newly connected device needs
+  USB_WAIT_PORT_STABLE_STALL to debounce before its port is reset. The stall
+  is done once after all the ports have been read, so that it covers all the
+  devices found connected, instead of one stall for each device.
+
+  @param  HubIf                 The HUB whose ports are going to be enumerated.
+  @param  ChangeMap             The port change bitmap of a normal hub, or NULL
+                                to check all the ports of a root hub.
+  @param  PortStates            Array of HubIf->NumOfPort entries receiving the
+                                status of each port. The change status of a
+                                port that is not read is set to zero.
+
+**/
+VOID
+UsbGetPortsStatus (
+  IN  USB_INTERFACE       *HubIf,
+  IN  UINT8               *ChangeMap  OPTIONAL,
+  OUT EFI_USB_PORT_STATUS *PortStates
+  )
+{
+  EFI_STATUS              Status;
+  BOOLEAN                 NewConnection;
+  UINT8                   Byte;
+  UINT8                   Bit;
+  UINT8                   Index;
+
+  ZeroMem (PortStates, HubIf->NumOfPort * sizeof (EFI_USB_PORT_STATUS));
+  NewConnection = FALSE;
+
+  //
+  // HUB starts its port index with 1.
+  //
+  Byte  = 0;
+  Bit   = 1;
+
+  for (Index = 0; Index < HubIf->NumOfPort; Index++) {
+    if ((ChangeMap == NULL) || USB_BIT_IS_SET (ChangeMap[Byte], USB_BIT (Bit))) {
+      //
+      // Host learns of the new device by polling the hub for port changes.
+      //
+      Status = HubIf->HubApi->GetPortStatus (HubIf, Index, &PortStates[Index]);
+
+      if (EFI_ERROR (Status)) {
+        DEBUG ((EFI_D_ERROR, "UsbGetPortsStatus: failed to get state of port %d\n", Index));
+        ZeroMem (&PortStates[Index], sizeof (EFI_USB_PORT_STATUS));
+
+      } else if (((PortStates[Index].PortChangeStatus & (USB_PORT_STAT_C_CONNECTION | USB_PORT_STAT_C_ENABLE | USB_PORT_STAT_C_OVERCURRENT | USB_PORT_STAT_C_RESET)) != 0) &&
+                 USB_BIT_IS_SET (PortStates[Index].PortStatus, USB_PORT_STAT_CONNECTION)) {
+        NewConnection = TRUE;
+      }
+    }
+
+    USB_NEXT_BIT (Byte, Bit);
+  }
+
+  if (NewConnection) {
+    gBS->Stall (USB_WAIT_PORT_STABLE_STALL);
+  }
+}
+
+
 /**
   Enumerate all the changed hub ports.
 
@@ -1008,6 +1068,7 @@ UsbHubEnumeration (
   UINT8                   Bit;
   UINT8                   Index;
   USB_DEVICE              *Child;
+  EFI_USB_PORT_STATUS     *PortStates;
   
   ASSERT (Context != NULL);
 
@@ -1025,6 +1086,13 @@ UsbHubEnumeration (
     return ;
   }
 
+  PortStates = AllocatePool (HubIf->NumOfPort * sizeof (EFI_USB_PORT_STATUS));
+  if (PortStates == NULL) {
+    return ;
+  }
+
+  UsbGetPortsStatus (HubIf, HubIf->ChangeMap, PortStates);
+
   //
   // HUB starts its port index with 1.
   //
@@ -1033,12 +1101,14 @@ UsbHubEnumeration (
 
   for (Index = 0; Index < HubIf->NumOfPort; Index++) {
     if (USB_BIT_IS_SET (HubIf->ChangeMap[Byte], USB_BIT (Bit))) {
-      UsbEnumeratePort (HubIf, Index);
+      UsbEnumeratePort (HubIf, Index, &PortStates[Index]);
     }
 
     USB_NEXT_BIT (Byte, Bit);
   }
 
+  FreePool (PortStates);
+
   UsbHubAckHubStatus (HubIf->Device);
 
   gBS->FreePool (HubIf->ChangeMap);
@@ -1064,6 +1134,7 @@ UsbRootHubEnumeration (
   USB_INTERFACE           *RootHub;
   UINT8                   Index;
   USB_DEVICE              *Child;
+  EFI_USB_PORT_STATUS     *PortStates;
 
   RootHub = (USB_INTERFACE *) Context;
 
@@ -1073,7 +1144,18 @@ UsbRootHubEnumeration (
       DEBUG (( EFI_D_INFO, "UsbEnumeratePort: The device disconnect fails at port %d from root hub %p, try again\n", Index, RootHub));
       UsbRemoveDevice (Child);
     }
-    
-    UsbEnumeratePort (RootHub, Index);
   }
+
+  PortStates = AllocatePool (RootHub->NumOfPort * sizeof (EFI_USB_PORT_STATUS));
+  if (PortStates == NULL) {
+    return ;
+  }
+
+  UsbGetPortsStatus (RootHub, NULL, PortStates);
+
+  for (Index = 0; Index < RootHub->NumOfPort; Index++) {
+    UsbEnumeratePort (RootHub, Index, &PortStates[Index]);
+  }
+
+  FreePool (PortStates);
 }
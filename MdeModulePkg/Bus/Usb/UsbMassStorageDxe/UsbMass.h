@@ -188,6 +188,7 @@ struct _USB_MASS_DEVICE {
   EFI_DISK_INFO_PROTOCOL    DiskInfo;
   USB_BOOT_INQUIRY_DATA     InquiryData;
   BOOLEAN                   Cdb16Byte;
+  BOOLEAN                   LargeTransfer; ///< Device accepts up to USB_BOOT_LARGE_TRANSFER_SIZE per command
 };
 
 #endif
@@ -765,6 +765,34 @@ ON_ERROR:
 }
 
 
+/**
+  Get the number of blocks carried by a single read or write command.
+
+  SuperSpeed devices take up to USB_BOOT_LARGE_TRANSFER_SIZE per command.
+  Other devices keep the conservative USB_BOOT_IO_BLOCKS limit.
+
+  @param  UsbMass                The USB mass storage device
+
+  @return The number of blocks per command.
+
+**/
+UINT16
+UsbBootGetTransferBlocks (
+  IN  USB_MASS_DEVICE       *UsbMass
+  )
+{
+  UINT32                    BlockSize;
+  UINT32                    Count;
+
+  BlockSize = UsbMass->BlockIoMedia.BlockSize;
+  if (!UsbMass->LargeTransfer || (BlockSize == 0)) {
+    return USB_BOOT_IO_BLOCKS;
+  }
+
+  Count = MIN (USB_BOOT_LARGE_TRANSFER_SIZE / BlockSize, MAX_UINT16);
+  return (UINT16) MAX (Count, USB_BOOT_IO_BLOCKS);
+}
+
 /**
   Read some blocks from the device.
 
@@ -788,11 +816,13 @@ UsbBootReadBlocks (
   USB_BOOT_READ10_CMD       ReadCmd;
   EFI_STATUS                Status;
   UINT16                    Count;
+  UINT16                    MaxBlocks;
   UINT32                    BlockSize;
   UINT32                    ByteSize;
   UINT32                    Timeout;
 
   BlockSize = UsbMass->BlockIoMedia.BlockSize;
+  MaxBlocks = UsbBootGetTransferBlocks (UsbMass);
   Status    = EFI_SUCCESS;
 
   while (TotalBlock > 0) {
@@ -801,7 +831,7 @@ UsbBootReadBlocks (
     // on the device. We must split the total block because the READ10
     // command only has 16 bit transfer length (in the unit of block).
     //
-    Count     = (UINT16)((TotalBlock < USB_BOOT_IO_BLOCKS) ? TotalBlock : USB_BOOT_IO_BLOCKS);
+    Count     = (UINT16)((TotalBlock < MaxBlocks) ? TotalBlock : MaxBlocks);
     ByteSize  = (UINT32)Count * BlockSize;
 
     //
@@ -864,11 +894,13 @@ UsbBootWriteBlocks (
   USB_BOOT_WRITE10_CMD  WriteCmd;
   EFI_STATUS            Status;
   UINT16                Count;
+  UINT16                MaxBlocks;
   UINT32                BlockSize;
   UINT32                ByteSize;
   UINT32                Timeout;
 
   BlockSize = UsbMass->BlockIoMedia.BlockSize;
+  MaxBlocks = UsbBootGetTransferBlocks (UsbMass);
   Status    = EFI_SUCCESS;
 
   while (TotalBlock > 0) {
@@ -877,7 +909,7 @@ UsbBootWriteBlocks (
     // on the device. We must split the total block because the WRITE10
     // command only has 16 bit transfer length (in the unit of block).
     //
-    Count     = (UINT16)((TotalBlock < USB_BOOT_IO_BLOCKS) ? TotalBlock : USB_BOOT_IO_BLOCKS);
+    Count     = (UINT16)((TotalBlock < MaxBlocks) ? TotalBlock : MaxBlocks);
     ByteSize  = (UINT32)Count * BlockSize;
 
     //
@@ -940,18 +972,20 @@ UsbBootReadBlocks16 (
   UINT8                     ReadCmd[16];
   EFI_STATUS                Status;
   UINT16                    Count;
+  UINT16                    MaxBlocks;
   UINT32                    BlockSize;
   UINT32                    ByteSize;
   UINT32                    Timeout;
 
   BlockSize = UsbMass->BlockIoMedia.BlockSize;
+  MaxBlocks = UsbBootGetTransferBlocks (UsbMass);
   Status    = EFI_SUCCESS;
 
   while (TotalBlock > 0) {
     //
     // Split the total blocks into smaller pieces.
     //
-    Count     = (UINT16)((TotalBlock < USB_BOOT_IO_BLOCKS) ? TotalBlock : USB_BOOT_IO_BLOCKS);
+    Count     = (UINT16)((TotalBlock < MaxBlocks) ? TotalBlock : MaxBlocks);
     ByteSize  = (UINT32)Count * BlockSize;
 
     //
@@ -1014,18 +1048,20 @@ UsbBootWriteBlocks16 (
   UINT8                 WriteCmd[16];
   EFI_STATUS            Status;
   UINT16                Count;
+  UINT16                MaxBlocks;
   UINT32                BlockSize;
   UINT32                ByteSize;
   UINT32                Timeout;
 
   BlockSize = UsbMass->BlockIoMedia.BlockSize;
+  MaxBlocks = UsbBootGetTransferBlocks (UsbMass);
   Status    = EFI_SUCCESS;
 
   while (TotalBlock > 0) {
     //
     // Split the total blocks into smaller pieces.
     //
-    Count     = (UINT16)((TotalBlock < USB_BOOT_IO_BLOCKS) ? TotalBlock : USB_BOOT_IO_BLOCKS);
+    Count     = (UINT16)((TotalBlock < MaxBlocks) ? TotalBlock : MaxBlocks);
     ByteSize  = (UINT32)Count * BlockSize;
 
     //
@@ -68,6 +68,13 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 //
 #define USB_BOOT_IO_BLOCKS              128
 
+//
+// Max carried size of a single command for SuperSpeed devices, which are
+// recognized by the 1024-byte max packet size of their bulk endpoints.
+//
+#define USB_BOOT_LARGE_TRANSFER_SIZE    SIZE_1MB
+#define USB_BOOT_SS_BULK_PACKET_SIZE    1024
+
 //
 // Retry mass command times, set by experience
 //
@@ -270,6 +277,19 @@ UsbBootDetectMedia (
   IN  USB_MASS_DEVICE       *UsbMass
   );
 
+/**
+  Get the number of blocks carried by a single read or write command.
+
+  @param  UsbMass                The USB mass storage device
+
+  @return The number of blocks per command.
+
+**/
+UINT16
+UsbBootGetTransferBlocks (
+  IN  USB_MASS_DEVICE       *UsbMass
+  );
+
 /**
   Read some blocks from the device.
 
@@ -346,9 +346,21 @@ UsbMassInitMedia (
 {
   EFI_BLOCK_IO_MEDIA          *Media;
   EFI_STATUS                  Status;
+  USB_BOT_PROTOCOL            *UsbBot;
 
   Media = &UsbMass->BlockIoMedia;
 
+  //
+  // SuperSpeed devices, recognized by the max packet size of their bulk
+  // endpoints, are given larger transfers per command. CBI is only defined
+  // for full-speed devices.
+  //
+  UsbMass->LargeTransfer = FALSE;
+  if (UsbMass->Transport->Protocol == USB_MASS_STORE_BOT) {
+    UsbBot = (USB_BOT_PROTOCOL *) UsbMass->Context;
+    UsbMass->LargeTransfer = (BOOLEAN) (UsbBot->BulkInEndpoint->MaxPacketSize >= USB_BOOT_SS_BULK_PACKET_SIZE);
+  }
+
   //
   // Fields of EFI_BLOCK_IO_MEDIA are defined in UEFI 2.0 spec,
   // section for Block I/O Protocol.
@@ -21,7 +21,11 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 
 #include <Uefi.h>
 
-UINT32  mCrcTable[256];
+//
+// mCrcTable[0] is the classic byte-wise table; mCrcTable[1..7] extend it so
+// that eight bytes can be processed per step ("slicing-by-8").
+//
+UINT32  mCrcTable[8][256];
 
 /**
   Calculate CRC32 for target data.
@@ -44,7 +48,8 @@ RuntimeDriverCalculateCrc32 (
   )
 {
   UINT32  Crc;
-  UINTN   Index;
+  UINT32  Low;
+  UINT32  High;
   UINT8   *Ptr;
 
   if (Data == NULL || DataSize == 0 || CrcOut == NULL) {
@@ -52,8 +57,36 @@ RuntimeDriverCalculateCrc32 (
   }
 
   Crc = 0xffffffff;
-  for (Index = 0, Ptr = Data; Index < DataSize; Index++, Ptr++) {
-    Crc = (Crc >> 8) ^ mCrcTable[(UINT8) Crc ^ *Ptr];
+  Ptr = Data;
+
+  //
+  // Process single bytes up to a 64-bit boundary, then eight bytes at a time.
+  //
+  while ((DataSize > 0) && (((UINTN) Ptr & 0x7) != 0)) {
+    Crc = (Crc >> 8) ^ mCrcTable[0][(UINT8) Crc ^ *Ptr];
+    Ptr++;
+    DataSize--;
+  }
+
+  while (DataSize >= 8) {
+    Low  = *(UINT32 *) Ptr ^ Crc;
+    High = *(UINT32 *) (Ptr + 4);
+    Crc  = mCrcTable[7][Low & 0xff] ^
+           mCrcTable[6][(Low >> 8) & 0xff] ^
+           mCrcTable[5][(Low >> 16) & 0xff] ^
+           mCrcTable[4][Low >> 24] ^
+           mCrcTable[3][High & 0xff] ^
+           mCrcTable[2][(High >> 8) & 0xff] ^
+           mCrcTable[1][(High >> 16) & 0xff] ^
+           mCrcTable[0][High >> 24];
+    Ptr      += 8;
+    DataSize -= 8;
+  }
+
+  while (DataSize > 0) {
+    Crc = (Crc >> 8) ^ mCrcTable[0][(UINT8) Crc ^ *Ptr];
+    Ptr++;
+    DataSize--;
   }
 
   *CrcOut = Crc ^ 0xffffffff;
@@ -110,6 +143,13 @@ RuntimeDriverInitializeCrc32Table (
       }
     }
 
-    mCrcTable[TableEntry] = ReverseBits (Value);
+    mCrcTable[0][TableEntry] = ReverseBits (Value);
+  }
+
+  for (Index = 1; Index < 8; Index++) {
+    for (TableEntry = 0; TableEntry < 256; TableEntry++) {
+      Value = mCrcTable[Index - 1][TableEntry];
+      mCrcTable[Index][TableEntry] = (Value >> 8) ^ mCrcTable[0][Value & 0xff];
+    }
   }
 }
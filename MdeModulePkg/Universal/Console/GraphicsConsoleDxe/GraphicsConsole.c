@@ -42,7 +42,9 @@ GRAPHICS_CONSOLE_DEV    mGraphicsConsoleDevTemplate = {
     TRUE
   },
   (GRAPHICS_CONSOLE_MODE_DATA *) NULL,
-  (EFI_GRAPHICS_OUTPUT_BLT_PIXEL *) NULL
+  (EFI_GRAPHICS_OUTPUT_BLT_PIXEL *) NULL,
+  (GRAPHICS_CONSOLE_GLYPH *) NULL,
+  FALSE
 };
 
 GRAPHICS_CONSOLE_MODE_DATA mGraphicsConsoleModeData[] = {
@@ -430,6 +432,14 @@ GraphicsConsoleControllerDriverStart (
     goto Error;
   }
 
+  if (Private->GraphicsOutput != NULL) {
+    //
+    // The glyph cache is only an accelerator, so carry on without it if it
+    // cannot be allocated.
+    //
+    Private->GlyphCache = AllocateZeroPool (sizeof (GRAPHICS_CONSOLE_GLYPH) * GRAPHICS_CONSOLE_GLYPH_CACHE_SIZE);
+  }
+
   HorizontalResolution  = PcdGet32 (PcdVideoHorizontalResolution);
   VerticalResolution    = PcdGet32 (PcdVideoVerticalResolution);
 
@@ -618,6 +628,10 @@ Error:
       FreePool (Private->LineBuffer);
     }
 
+    if (Private->GlyphCache != NULL) {
+      FreePool (Private->GlyphCache);
+    }
+
     if (Private->ModeData != NULL) {
       FreePool (Private->ModeData);
     }
@@ -706,6 +720,10 @@ GraphicsConsoleControllerDriverStop (
       FreePool (Private->LineBuffer);
     }
 
+    if (Private->GlyphCache != NULL) {
+      FreePool (Private->GlyphCache);
+    }
+
     if (Private->ModeData != NULL) {
       FreePool (Private->ModeData);
     }
@@ -847,7 +865,17 @@ GraphicsConsoleConOutReset (
   IN  BOOLEAN                          ExtendedVerification
   )
 {
-  EFI_STATUS    Status;
+  EFI_STATUS            Status;
+  GRAPHICS_CONSOLE_DEV  *Private;
+
+  //
+  // Font packages may have changed since the glyphs were cached.
+  //
+  Private = GRAPHICS_CONSOLE_CON_OUT_DEV_FROM_THIS (This);
+  if (Private->GlyphCache != NULL) {
+    ZeroMem (Private->GlyphCache, sizeof (GRAPHICS_CONSOLE_GLYPH) * GRAPHICS_CONSOLE_GLYPH_CACHE_SIZE);
+  }
+
   Status = This->SetMode (This, 0);
   if (EFI_ERROR (Status)) {
     return Status;
@@ -1441,6 +1469,7 @@ GraphicsConsoleConOutSetMode (
   //
   This->Mode->CursorColumn  = 0;
   This->Mode->CursorRow     = 0;
+  Private->CursorDrawn      = FALSE;
 
   FlushCursor (This);  
 
@@ -1574,6 +1603,7 @@ GraphicsConsoleConOutClearScreen (
 
   This->Mode->CursorColumn  = 0;
   This->Mode->CursorRow     = 0;
+  Private->CursorDrawn      = FALSE;
 
   FlushCursor (This);
 
@@ -1722,6 +1752,158 @@ GetTextColors (
   return EFI_SUCCESS;
 }
 
+/**
+  Get a narrow glyph rendered in the colors of the given attribute.
+
+  Glyphs are rendered once by the HII Font protocol into a bitmap and
+  kept in a direct mapped cache, so that drawing text does not need to
+  go through the HII database for every character.
+
+  @param  Private               Graphics Console device instance.
+  @param  Char                  The character to render.
+  @param  Attribute             The text attribute giving the colors.
+
+  @return The cached glyph, or NULL if the character is not a narrow glyph
+          that can be rendered on its own.
+
+**/
+GRAPHICS_CONSOLE_GLYPH *
+GetCachedGlyph (
+  IN  GRAPHICS_CONSOLE_DEV             *Private,
+  IN  CHAR16                           Char,
+  IN  UINT8                            Attribute
+  )
+{
+  EFI_STATUS                        Status;
+  GRAPHICS_CONSOLE_GLYPH            *Glyph;
+  EFI_IMAGE_OUTPUT                  Image;
+  EFI_IMAGE_OUTPUT                  *Blt;
+  EFI_FONT_DISPLAY_INFO             FontInfo;
+  EFI_HII_ROW_INFO                  *RowInfoArray;
+  UINTN                             RowInfoArraySize;
+  CHAR16                            String[2];
+
+  Glyph = &Private->GlyphCache[GRAPHICS_CONSOLE_GLYPH_CACHE_INDEX (Char, Attribute)];
+  if (Glyph->Valid && Glyph->Char == Char && Glyph->Attribute == Attribute) {
+    return Glyph;
+  }
+
+  Glyph->Valid     = FALSE;
+  Glyph->Char      = Char;
+  Glyph->Attribute = Attribute;
+
+  String[0] = Char;
+  String[1] = L'\0';
+
+  ZeroMem (&FontInfo, sizeof (FontInfo));
+  FontInfo.ForegroundColor = mGraphicsEfiColors[Attribute & 0x0f];
+  FontInfo.BackgroundColor = mGraphicsEfiColors[Attribute >> 4];
+
+  Image.Width        = EFI_GLYPH_WIDTH;
+  Image.Height       = EFI_GLYPH_HEIGHT;
+  Image.Image.Bitmap = Glyph->Bitmap;
+  Blt                = &Image;
+
+  RowInfoArray = NULL;
+  Status = mHiiFont->StringToImage (
+                       mHiiFont,
+                       EFI_HII_IGNORE_IF_NO_GLYPH | EFI_HII_IGNORE_LINE_BREAK,
+                       String,
+                       &FontInfo,
+                       &Blt,
+                       0,
+                       0,
+                       &RowInfoArray,
+                       &RowInfoArraySize,
+                       NULL
+                       );
+  if (!EFI_ERROR (Status) &&
+      (RowInfoArraySize == 1) &&
+      (RowInfoArray[0].LineWidth == EFI_GLYPH_WIDTH) &&
+      (RowInfoArray[0].LineHeight == EFI_GLYPH_HEIGHT)) {
+    Glyph->Valid = TRUE;
+  }
+
+  if (RowInfoArray != NULL) {
+    FreePool (RowInfoArray);
+  }
+
+  return Glyph->Valid ? Glyph : NULL;
+}
+
+/**
+  Draw Unicode string on the Graphics Console device's screen using the
+  glyph cache.
+
+  The glyphs are composed into the line buffer and sent to the screen with a
+  single Blt.
+
+  @param  This                  Protocol instance pointer.
+  @param  UnicodeWeight         One Unicode string to be displayed.
+  @param  Count                 The count of Unicode string.
+
+  @retval EFI_UNSUPPORTED       The string cannot be drawn from the glyph cache.
+  @retval EFI_SUCCESS           Drawing Unicode string implemented successfully.
+
+**/
+EFI_STATUS
+DrawCachedGlyphsAtCursorN (
+  IN  EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL  *This,
+  IN  CHAR16                           *UnicodeWeight,
+  IN  UINTN                            Count
+  )
+{
+  GRAPHICS_CONSOLE_DEV              *Private;
+  GRAPHICS_CONSOLE_MODE_DATA        *ModeData;
+  GRAPHICS_CONSOLE_GLYPH            *Glyph;
+  UINT8                             Attribute;
+  UINTN                             Index;
+  UINTN                             PosY;
+  UINTN                             Width;
+
+  Private  = GRAPHICS_CONSOLE_CON_OUT_DEV_FROM_THIS (This);
+  ModeData = &Private->ModeData[This->Mode->Mode];
+
+  if ((Private->GraphicsOutput == NULL) ||
+      (Private->GlyphCache == NULL) ||
+      (Private->LineBuffer == NULL) ||
+      ((This->Mode->Attribute & EFI_WIDE_ATTRIBUTE) != 0) ||
+      (Count == 0) ||
+      (Count > ModeData->Columns)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  Attribute = (UINT8) (This->Mode->Attribute & 0x7F);
+  Width     = Count * EFI_GLYPH_WIDTH;
+
+  for (Index = 0; Index < Count; Index++) {
+    Glyph = GetCachedGlyph (Private, UnicodeWeight[Index], Attribute);
+    if (Glyph == NULL) {
+      return EFI_UNSUPPORTED;
+    }
+    for (PosY = 0; PosY < EFI_GLYPH_HEIGHT; PosY++) {
+      CopyMem (
+        &Private->LineBuffer[PosY * Width + Index * EFI_GLYPH_WIDTH],
+        &Glyph->Bitmap[PosY * EFI_GLYPH_WIDTH],
+        EFI_GLYPH_WIDTH * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+        );
+    }
+  }
+
+  return Private->GraphicsOutput->Blt (
+                                    Private->GraphicsOutput,
+                                    Private->LineBuffer,
+                                    EfiBltBufferToVideo,
+                                    0,
+                                    0,
+                                    This->Mode->CursorColumn * EFI_GLYPH_WIDTH + ModeData->DeltaX,
+                                    This->Mode->CursorRow * EFI_GLYPH_HEIGHT + ModeData->DeltaY,
+                                    Width,
+                                    EFI_GLYPH_HEIGHT,
+                                    Width * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+                                    );
+}
+
 /**
   Draw Unicode string on the Graphics Console device's screen.
 
@@ -1751,6 +1933,15 @@ DrawUnicodeWeightAtCursorN (
   EFI_HII_ROW_INFO                  *RowInfoArray;
   UINTN                             RowInfoArraySize;
 
+  //
+  // Use the pre-rendered glyphs when possible, and fall back to rendering
+  // the whole string through HII Font otherwise.
+  //
+  Status = DrawCachedGlyphsAtCursorN (This, UnicodeWeight, Count);
+  if (!EFI_ERROR (Status)) {
+    return Status;
+  }
+
   Private = GRAPHICS_CONSOLE_CON_OUT_DEV_FROM_THIS (This);
   Blt = (EFI_IMAGE_OUTPUT *) AllocateZeroPool (sizeof (EFI_IMAGE_OUTPUT));
   if (Blt == NULL) {
@@ -1902,6 +2093,7 @@ FlushCursor (
   EFI_GRAPHICS_OUTPUT_BLT_PIXEL_UNION BltChar[EFI_GLYPH_HEIGHT][EFI_GLYPH_WIDTH];
   UINTN                               PosX;
   UINTN                               PosY;
+  EFI_STATUS                          Status;
 
   CurrentMode = This->Mode;
 
@@ -1921,32 +2113,83 @@ FlushCursor (
   //
   GlyphX  = (CurrentMode->CursorColumn * EFI_GLYPH_WIDTH) + Private->ModeData[CurrentMode->Mode].DeltaX;
   GlyphY  = (CurrentMode->CursorRow * EFI_GLYPH_HEIGHT) + Private->ModeData[CurrentMode->Mode].DeltaY;
+
+  if (Private->CursorDrawn &&
+      (Private->CursorDrawnColumn == CurrentMode->CursorColumn) &&
+      (Private->CursorDrawnRow == CurrentMode->CursorRow)) {
+    //
+    // The cursor is shown at this position, so erase it by restoring the saved
+    // cell instead of reading the frame buffer back.
+    //
+    Private->CursorDrawn = FALSE;
+    if (GraphicsOutput != NULL) {
+      GraphicsOutput->Blt (
+                GraphicsOutput,
+                Private->CursorCell,
+                EfiBltBufferToVideo,
+                0,
+                0,
+                GlyphX,
+                GlyphY,
+                EFI_GLYPH_WIDTH,
+                EFI_GLYPH_HEIGHT,
+                EFI_GLYPH_WIDTH * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+                );
+    } else if (FeaturePcdGet (PcdUgaConsumeSupport)) {
+      UgaDraw->Blt (
+                UgaDraw,
+                (EFI_UGA_PIXEL *) (UINTN) Private->CursorCell,
+                EfiUgaBltBufferToVideo,
+                0,
+                0,
+                GlyphX,
+                GlyphY,
+                EFI_GLYPH_WIDTH,
+                EFI_GLYPH_HEIGHT,
+                EFI_GLYPH_WIDTH * sizeof (EFI_UGA_PIXEL)
+                );
+    }
+    return EFI_SUCCESS;
+  }
+
+  Status = EFI_UNSUPPORTED;
   if (GraphicsOutput != NULL) {
-    GraphicsOutput->Blt (
-              GraphicsOutput,
-              (EFI_GRAPHICS_OUTPUT_BLT_PIXEL *) BltChar,
-              EfiBltVideoToBltBuffer,
-              GlyphX,
-              GlyphY,
-              0,
-              0,
-              EFI_GLYPH_WIDTH,
-              EFI_GLYPH_HEIGHT,
-              EFI_GLYPH_WIDTH * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
-              );
+    Status = GraphicsOutput->Blt (
+                       GraphicsOutput,
+                       (EFI_GRAPHICS_OUTPUT_BLT_PIXEL *) BltChar,
+                       EfiBltVideoToBltBuffer,
+                       GlyphX,
+                       GlyphY,
+                       0,
+                       0,
+                       EFI_GLYPH_WIDTH,
+                       EFI_GLYPH_HEIGHT,
+                       EFI_GLYPH_WIDTH * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+                       );
   } else if (FeaturePcdGet (PcdUgaConsumeSupport)) {
-    UgaDraw->Blt (
-              UgaDraw,
-              (EFI_UGA_PIXEL *) (UINTN) BltChar,
-              EfiUgaVideoToBltBuffer,
-              GlyphX,
-              GlyphY,
-              0,
-              0,
-              EFI_GLYPH_WIDTH,
-              EFI_GLYPH_HEIGHT,
-              EFI_GLYPH_WIDTH * sizeof (EFI_UGA_PIXEL)
-              );
+    Status = UgaDraw->Blt (
+                        UgaDraw,
+                        (EFI_UGA_PIXEL *) (UINTN) BltChar,
+                        EfiUgaVideoToBltBuffer,
+                        GlyphX,
+                        GlyphY,
+                        0,
+                        0,
+                        EFI_GLYPH_WIDTH,
+                        EFI_GLYPH_HEIGHT,
+                        EFI_GLYPH_WIDTH * sizeof (EFI_UGA_PIXEL)
+                        );
+  }
+
+  //
+  // Remember what is under the cursor so the next flush at this position can
+  // erase it with a single write.
+  //
+  Private->CursorDrawn = (BOOLEAN) !EFI_ERROR (Status);
+  if (Private->CursorDrawn) {
+    Private->CursorDrawnColumn = CurrentMode->CursorColumn;
+    Private->CursorDrawnRow    = CurrentMode->CursorRow;
+    CopyMem (Private->CursorCell, BltChar, sizeof (Private->CursorCell));
   }
 
   GetTextColors (This, &Foreground.Pixel, &Background.Pixel);
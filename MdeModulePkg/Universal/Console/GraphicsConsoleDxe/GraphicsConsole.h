@@ -63,6 +63,24 @@ typedef struct {
   UINT32  GopModeNumber;
 } GRAPHICS_CONSOLE_MODE_DATA;
 
+//
+// Number of entries in the rendered glyph cache. Must be a power of 2.
+//
+#define GRAPHICS_CONSOLE_GLYPH_CACHE_SIZE  512
+
+#define GRAPHICS_CONSOLE_GLYPH_CACHE_INDEX(Char, Attribute) \
+  (((UINTN) (Char) + (UINTN) (Attribute) * 0x9B) & (GRAPHICS_CONSOLE_GLYPH_CACHE_SIZE - 1))
+
+//
+// A narrow glyph already rendered in the colors of one text attribute.
+//
+typedef struct {
+  CHAR16                           Char;
+  UINT8                            Attribute;
+  BOOLEAN                          Valid;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL    Bitmap[EFI_GLYPH_HEIGHT * EFI_GLYPH_WIDTH];
+} GRAPHICS_CONSOLE_GLYPH;
+
 typedef struct {
   UINTN                            Signature;
   EFI_GRAPHICS_OUTPUT_PROTOCOL     *GraphicsOutput;
@@ -71,6 +89,18 @@ typedef struct {
   EFI_SIMPLE_TEXT_OUTPUT_MODE      SimpleTextOutputMode;
   GRAPHICS_CONSOLE_MODE_DATA       *ModeData;
   EFI_GRAPHICS_OUTPUT_BLT_PIXEL    *LineBuffer;
+  //
+  // Glyphs rendered by HII Font, looked up by character and attribute.
+  //
+  GRAPHICS_CONSOLE_GLYPH           *GlyphCache;
+  //
+  // Screen contents under the cursor while it is drawn, so it can be erased
+  // without reading the frame buffer back.
+  //
+  BOOLEAN                          CursorDrawn;
+  INT32                            CursorDrawnColumn;
+  INT32                            CursorDrawnRow;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL    CursorCell[EFI_GLYPH_HEIGHT * EFI_GLYPH_WIDTH];
 } GRAPHICS_CONSOLE_DEV;
 
 #define GRAPHICS_CONSOLE_CON_OUT_DEV_FROM_THIS(a) \
@@ -532,6 +562,43 @@ GetTextColors (
   OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL    *Background
   );
 
+/**
+  Get a narrow glyph rendered in the colors of the given attribute.
+
+  @param  Private               Graphics Console device instance.
+  @param  Char                  The character to render.
+  @param  Attribute             The text attribute giving the colors.
+
+  @return The cached glyph, or NULL if the character is not a narrow glyph
+          that can be rendered on its own.
+
+**/
+GRAPHICS_CONSOLE_GLYPH *
+GetCachedGlyph (
+  IN  GRAPHICS_CONSOLE_DEV             *Private,
+  IN  CHAR16                           Char,
+  IN  UINT8                            Attribute
+  );
+
+/**
+  Draw Unicode string on the Graphics Console device's screen using the
+  glyph cache.
+
+  @param  This                  Protocol instance pointer.
+  @param  UnicodeWeight         One Unicode string to be displayed.
+  @param  Count                 The count of Unicode string.
+
+  @retval EFI_UNSUPPORTED       The string cannot be drawn from the glyph cache.
+  @retval EFI_SUCCESS           Drawing Unicode string implemented successfully.
+
+**/
+EFI_STATUS
+DrawCachedGlyphsAtCursorN (
+  IN  EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL  *This,
+  IN  CHAR16                           *UnicodeWeight,
+  IN  UINTN                            Count
+  );
+
 /**
   Draw Unicode string on the Graphics Console device's screen.
 
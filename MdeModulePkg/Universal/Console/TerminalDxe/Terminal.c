@@ -92,7 +92,8 @@ TERMINAL_DEV  mTerminalDevTemplate = {
   {   // NotifyList
     NULL,
     NULL,
-  }
+  },
+  FALSE // CursorPositionValid
 };
 
 TERMINAL_CONSOLE_MODE_DATA mTerminalConsoleModeData[] = {
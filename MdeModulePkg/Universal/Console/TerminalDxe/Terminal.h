@@ -109,8 +109,19 @@ typedef struct {
   BOOLEAN                             OutputEscChar;
   EFI_SIMPLE_TEXT_INPUT_EX_PROTOCOL   SimpleInputEx;
   LIST_ENTRY                          NotifyList;
+  //
+  // TRUE when the terminal cursor is known to be at the position recorded in
+  // SimpleTextOutputMode, because it was set explicitly and no text has been
+  // output since. Used to drop redundant cursor positioning sequences.
+  //
+  BOOLEAN                             CursorPositionValid;
 } TERMINAL_DEV;
 
+//
+// Number of bytes OutputString() collects before writing them to the serial device.
+//
+#define TERMINAL_OUTPUT_BUFFER_SIZE   256
+
 #define INPUT_STATE_DEFAULT               0x00
 #define INPUT_STATE_ESC                   0x01
 #define INPUT_STATE_CSI                   0x02
@@ -148,8 +159,8 @@ typedef union {
 #define CSI                       0x9B
 #define DEL                       127
 #define BRIGHT_CONTROL_OFFSET     2
-#define FOREGROUND_CONTROL_OFFSET 6
-#define BACKGROUND_CONTROL_OFFSET 11
+#define FOREGROUND_CONTROL_OFFSET 4
+#define BACKGROUND_CONTROL_OFFSET 7
 #define ROW_OFFSET                2
 #define COLUMN_OFFSET             5
 
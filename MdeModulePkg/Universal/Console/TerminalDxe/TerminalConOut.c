@@ -79,7 +79,7 @@ UNICODE_TO_CHAR  UnicodeToPcAnsiOrAscii[] = {
 };
 
 CHAR16 mSetModeString[]            = { ESC, '[', '=', '3', 'h', 0 };
-CHAR16 mSetAttributeString[]       = { ESC, '[', '0', 'm', ESC, '[', '4', '0', 'm', ESC, '[', '4', '0', 'm', 0 };
+CHAR16 mSetAttributeString[]       = { ESC, '[', '0', ';', '3', '7', ';', '4', '0', 'm', 0 };
 CHAR16 mClearScreenString[]        = { ESC, '[', '2', 'J', 0 };
 CHAR16 mSetCursorPositionString[]  = { ESC, '[', '0', '0', ';', '0', '0', 'H', 0 };
 
@@ -143,6 +143,8 @@ TerminalConOutReset (
     }
   }
 
+  TerminalDevice->CursorPositionValid = FALSE;
+
   This->SetAttribute (This, EFI_TEXT_ATTR (This->Mode->Attribute & 0x0F, EFI_BLACK));
 
   Status = This->SetMode (This, 0);
@@ -185,15 +187,18 @@ TerminalConOutOutputString (
   CHAR8                       AsciiChar;
   EFI_STATUS                  Status;
   UINT8                       ValidBytes;
+  UINT8                       OutputBuffer[TERMINAL_OUTPUT_BUFFER_SIZE];
+  UINTN                       OutputLength;
   //
   //  flag used to indicate whether condition happens which will cause
   //  return EFI_WARN_UNKNOWN_GLYPH
   //
   BOOLEAN                     Warning;
 
-  ValidBytes  = 0;
-  Warning     = FALSE;
-  AsciiChar   = 0;
+  ValidBytes    = 0;
+  Warning       = FALSE;
+  AsciiChar     = 0;
+  OutputLength  = 0;
 
   //
   //  get Terminal device data structure pointer.
@@ -216,8 +221,33 @@ TerminalConOutOutputString (
           &MaxRow
           );
 
+  //
+  // Text moves the terminal cursor, control sequences written by this driver
+  // do not.
+  //
+  if (!TerminalDevice->OutputEscChar) {
+    TerminalDevice->CursorPositionValid = FALSE;
+  }
+
   for (; *WString != CHAR_NULL; WString++) {
 
+    //
+    // Make room for the longest encoding of one character, so that the data
+    // goes to the serial device in as few writes as possible.
+    //
+    if (OutputLength + sizeof (UTF8_CHAR) > sizeof (OutputBuffer)) {
+      Length = OutputLength;
+      Status = TerminalDevice->SerialIo->Write (
+                                          TerminalDevice->SerialIo,
+                                          &Length,
+                                          OutputBuffer
+                                          );
+      if (EFI_ERROR (Status)) {
+        goto OutputError;
+      }
+      OutputLength = 0;
+    }
+
     switch (TerminalDevice->TerminalType) {
 
     case PCANSITYPE:
@@ -252,31 +282,13 @@ TerminalConOutOutputString (
         GraphicChar = AsciiChar;
       }
 
-      Length = 1;
-
-      Status = TerminalDevice->SerialIo->Write (
-                                          TerminalDevice->SerialIo,
-                                          &Length,
-                                          &GraphicChar
-                                          );
-
-      if (EFI_ERROR (Status)) {
-        goto OutputError;
-      }
-
+      OutputBuffer[OutputLength++] = (UINT8) GraphicChar;
       break;
 
     case VTUTF8TYPE:
       UnicodeToUtf8 (*WString, &Utf8Char, &ValidBytes);
-      Length = ValidBytes;
-      Status = TerminalDevice->SerialIo->Write (
-                                          TerminalDevice->SerialIo,
-                                          &Length,
-                                          (UINT8 *) &Utf8Char
-                                          );
-      if (EFI_ERROR (Status)) {
-        goto OutputError;
-      }
+      CopyMem (&OutputBuffer[OutputLength], &Utf8Char, ValidBytes);
+      OutputLength += ValidBytes;
       break;
     }
     //
@@ -319,6 +331,18 @@ TerminalConOutOutputString (
 
   }
 
+  if (OutputLength != 0) {
+    Length = OutputLength;
+    Status = TerminalDevice->SerialIo->Write (
+                                        TerminalDevice->SerialIo,
+                                        &Length,
+                                        OutputBuffer
+                                        );
+    if (EFI_ERROR (Status)) {
+      goto OutputError;
+    }
+  }
+
   if (Warning) {
     return EFI_WARN_UNKNOWN_GLYPH;
   }
@@ -467,6 +491,8 @@ TerminalConOutSetMode (
   //
   This->Mode->Mode = (INT32) ModeNumber;
 
+  TerminalDevice->CursorPositionValid = FALSE;
+
   This->ClearScreen (This);
 
   TerminalDevice->OutputEscChar = TRUE;
@@ -752,6 +778,16 @@ TerminalConOutSetCursorPosition (
   if (Column >= MaxColumn || Row >= MaxRow) {
     return EFI_UNSUPPORTED;
   }
+
+  //
+  // Skip outputting the command string if the terminal cursor is already there
+  //
+  if (TerminalDevice->CursorPositionValid &&
+      (Mode->CursorColumn == (INT32) Column) &&
+      (Mode->CursorRow == (INT32) Row)) {
+    return EFI_SUCCESS;
+  }
+
   //
   // control sequence to move the cursor
   //
@@ -774,6 +810,8 @@ TerminalConOutSetCursorPosition (
   Mode->CursorColumn  = (INT32) Column;
   Mode->CursorRow     = (INT32) Row;
 
+  TerminalDevice->CursorPositionValid = TRUE;
+
   return EFI_SUCCESS;
 }
 
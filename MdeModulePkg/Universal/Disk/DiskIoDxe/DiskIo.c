@@ -191,6 +191,8 @@ DiskIoDriverBindingStart (
     goto ErrorExit;
   }
 
+  DiskIoInitializeCache (Instance);
+
   //
   // Install protocol interfaces for the Disk IO device.
   //
@@ -219,6 +221,7 @@ ErrorExit:
     }
 
     if (Instance != NULL) {
+      DiskIoFreeCache (Instance);
       FreePool (Instance);
     }
 
@@ -326,6 +329,7 @@ DiskIoDriverBindingStop (
       Instance->SharedWorkingBuffer,
       EFI_SIZE_TO_PAGES (PcdGet32 (PcdDiskIoDataBufferBlockNum) * Instance->BlockIo->Media->BlockSize)
       );
+    DiskIoFreeCache (Instance);
 
     Status = gBS->CloseProtocol (
                     ControllerHandle,
@@ -350,6 +354,227 @@ DiskIoDriverBindingStop (
   return Status;
 }
 
+/**
+  Allocate the optional block cache of the Disk IO instance.
+
+  The cache is sized by PcdDiskIoCacheBlockNum. A zero PCD value, a removable
+  medium, or a failure to allocate the cache, leaves the cache disabled, which
+  is not an error. Removable media are excluded because a cache hit does not
+  reach BlockIo, so a media change or removal would not be detected.
+
+  The cache only sees the writes issued through this Disk IO instance. Writes
+  made directly through BlockIo on the same handle are not observed.
+
+  @param Instance     Pointer to the DISK_IO_PRIVATE_DATA.
+**/
+VOID
+DiskIoInitializeCache (
+  IN DISK_IO_PRIVATE_DATA     *Instance
+  )
+{
+  EFI_BLOCK_IO_MEDIA       *Media;
+  UINT32                   IoAlign;
+  UINTN                    BlockNum;
+
+  Instance->CacheBlockNum = 0;
+  Instance->CacheEntries  = NULL;
+  Instance->CacheBuffer   = NULL;
+  Instance->CacheHits     = 0;
+  Instance->CacheMisses   = 0;
+
+  BlockNum = PcdGet32 (PcdDiskIoCacheBlockNum);
+  Media    = Instance->BlockIo->Media;
+  if ((BlockNum == 0) || (Media->BlockSize == 0) || Media->RemovableMedia) {
+    return;
+  }
+
+  IoAlign = Media->IoAlign;
+  if (IoAlign == 0) {
+    IoAlign = 1;
+  }
+  Instance->CacheBlockStride = ALIGN_VALUE (Media->BlockSize, IoAlign);
+
+  Instance->CacheEntries = AllocateZeroPool (BlockNum * sizeof (DISK_IO_CACHE_ENTRY));
+  if (Instance->CacheEntries == NULL) {
+    return;
+  }
+  Instance->CacheBuffer = AllocateAlignedPages (
+                            EFI_SIZE_TO_PAGES (BlockNum * Instance->CacheBlockStride),
+                            IoAlign
+                            );
+  if (Instance->CacheBuffer == NULL) {
+    FreePool (Instance->CacheEntries);
+    Instance->CacheEntries = NULL;
+    return;
+  }
+
+  Instance->CacheMediaId   = Media->MediaId;
+  Instance->CacheBlockSize = Media->BlockSize;
+  Instance->CacheBlockNum  = BlockNum;
+}
+
+/**
+  Free the block cache of the Disk IO instance.
+
+  @param Instance     Pointer to the DISK_IO_PRIVATE_DATA.
+**/
+VOID
+DiskIoFreeCache (
+  IN DISK_IO_PRIVATE_DATA     *Instance
+  )
+{
+  if (Instance->CacheBlockNum == 0) {
+    return;
+  }
+
+  DEBUG ((
+    EFI_D_INFO,
+    "DiskIo: Block cache hits/misses = %ld/%ld\n",
+    Instance->CacheHits,
+    Instance->CacheMisses
+    ));
+
+  FreeAlignedPages (
+    Instance->CacheBuffer,
+    EFI_SIZE_TO_PAGES (Instance->CacheBlockNum * Instance->CacheBlockStride)
+    );
+  FreePool (Instance->CacheEntries);
+  Instance->CacheBuffer   = NULL;
+  Instance->CacheEntries  = NULL;
+  Instance->CacheBlockNum = 0;
+}
+
+/**
+  Invalidate the cached blocks overlapping a byte range of the device.
+
+  @param Instance     Pointer to the DISK_IO_PRIVATE_DATA.
+  @param Offset       The starting byte offset of the range.
+  @param BufferSize   The size in bytes of the range. MAX_UINTN invalidates the whole cache.
+**/
+STATIC
+VOID
+DiskIoInvalidateCache (
+  IN DISK_IO_PRIVATE_DATA     *Instance,
+  IN UINT64                   Offset,
+  IN UINTN                    BufferSize
+  )
+{
+  UINT32                   BlockSize;
+  UINT64                   Lba;
+  UINT64                   LastLba;
+  UINTN                    Index;
+  DISK_IO_CACHE_ENTRY      *Entry;
+
+  if (Instance->CacheBlockNum == 0) {
+    return;
+  }
+
+  BlockSize = Instance->CacheBlockSize;
+  if ((BufferSize == MAX_UINTN) || (BufferSize / BlockSize >= Instance->CacheBlockNum)) {
+    ZeroMem (Instance->CacheEntries, Instance->CacheBlockNum * sizeof (DISK_IO_CACHE_ENTRY));
+    return;
+  }
+
+  Lba     = DivU64x32 (Offset, BlockSize);
+  LastLba = DivU64x32 (Offset + MAX (BufferSize, 1) - 1, BlockSize);
+  for (; Lba <= LastLba; Lba++) {
+    Index = (UINTN) ModU64x32 (Lba, (UINT32) Instance->CacheBlockNum);
+    Entry = &Instance->CacheEntries[Index];
+    if (Entry->Valid && (Entry->Lba == Lba)) {
+      Entry->Valid = FALSE;
+    }
+  }
+}
+
+/**
+  Serve a blocking read from the block cache.
+
+  Only requests that fall entirely within one block are served, which covers
+  the small metadata reads issued by file system drivers. On a miss the whole
+  block is read into the cache through BlockIo and the requested bytes are
+  copied from there.
+
+  @param Instance     Pointer to the DISK_IO_PRIVATE_DATA.
+  @param MediaId      ID of the medium to be read.
+  @param Offset       The starting byte offset to read from.
+  @param BufferSize   The size in bytes of Buffer.
+  @param Buffer       A pointer to the destination buffer for the data.
+
+  @retval EFI_UNSUPPORTED  The cache is disabled, the medium is not present or no
+                           longer has the block size the cache was built for, or
+                           the request does not fit in one block.
+  @retval others           The status of reading the block into the cache.
+**/
+STATIC
+EFI_STATUS
+DiskIoReadCachedBlock (
+  IN DISK_IO_PRIVATE_DATA     *Instance,
+  IN UINT32                   MediaId,
+  IN UINT64                   Offset,
+  IN UINTN                    BufferSize,
+  OUT UINT8                   *Buffer
+  )
+{
+  EFI_STATUS               Status;
+  EFI_BLOCK_IO_MEDIA       *Media;
+  UINT64                   Lba;
+  UINT32                   BlockOffset;
+  UINTN                    Index;
+  DISK_IO_CACHE_ENTRY      *Entry;
+  UINT8                    *Block;
+
+  Media = Instance->BlockIo->Media;
+  if ((Instance->CacheBlockNum == 0) || !Media->MediaPresent) {
+    return EFI_UNSUPPORTED;
+  }
+
+  //
+  // The cache slots are only large enough for the block size seen at Start.
+  //
+  if (Media->BlockSize != Instance->CacheBlockSize) {
+    return EFI_UNSUPPORTED;
+  }
+
+  if ((BufferSize == 0) || (BufferSize > Media->BlockSize)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  Lba = DivU64x32Remainder (Offset, Media->BlockSize, &BlockOffset);
+  if (BlockOffset + BufferSize > Media->BlockSize) {
+    return EFI_UNSUPPORTED;
+  }
+
+  //
+  // Drop everything cached for the previous medium.
+  //
+  if (Instance->CacheMediaId != Media->MediaId) {
+    DiskIoInvalidateCache (Instance, 0, MAX_UINTN);
+    Instance->CacheMediaId = Media->MediaId;
+  }
+
+  Index = (UINTN) ModU64x32 (Lba, (UINT32) Instance->CacheBlockNum);
+  Entry = &Instance->CacheEntries[Index];
+  Block = Instance->CacheBuffer + Index * Instance->CacheBlockStride;
+
+  if (Entry->Valid && (Entry->Lba == Lba)) {
+    Instance->CacheHits++;
+  } else {
+    Instance->CacheMisses++;
+    Entry->Valid = FALSE;
+    Status = Instance->BlockIo->ReadBlocks (Instance->BlockIo, MediaId, Lba, Media->BlockSize, Block);
+    if (EFI_ERROR (Status)) {
+      if (Status == EFI_MEDIA_CHANGED) {
+        DiskIoInvalidateCache (Instance, 0, MAX_UINTN);
+      }
+      return Status;
+    }
+    Entry->Lba   = Lba;
+    Entry->Valid = TRUE;
+  }
+
+  CopyMem (Buffer, Block + BlockOffset, BufferSize);
+  return EFI_SUCCESS;
+}
 
 /**
   Destroy the sub task.
@@ -841,12 +1066,24 @@ DiskIo2ReadWriteDisk (
     return EFI_WRITE_PROTECTED;
   }
 
+  if (Write) {
+    DiskIoInvalidateCache (Instance, Offset, BufferSize);
+  }
+
   if (Blocking) {
     //
     // Wait till pending async task is completed.
     //
     while (!DiskIo2RemoveCompletedTask (Instance));
 
+    if (!Write) {
+      Status = DiskIoReadCachedBlock (Instance, MediaId, Offset, BufferSize, Buffer);
+      if (Status != EFI_UNSUPPORTED) {
+        return Status;
+      }
+      Status = EFI_SUCCESS;
+    }
+
     SubtasksPtr = &Subtasks;
   } else {
     DiskIo2RemoveCompletedTask (Instance);
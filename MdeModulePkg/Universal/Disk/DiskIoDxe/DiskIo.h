@@ -30,6 +30,15 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 #include <Library/MemoryAllocationLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 
+//
+// One slot of the optional block cache. A slot caches the block whose LBA
+// is congruent to the slot index modulo the number of slots.
+//
+typedef struct {
+  UINT64                          Lba;
+  BOOLEAN                         Valid;
+} DISK_IO_CACHE_ENTRY;
+
 #define DISK_IO_PRIVATE_DATA_SIGNATURE  SIGNATURE_32 ('d', 's', 'k', 'I')
 typedef struct {
   UINT32                          Signature;
@@ -43,6 +52,20 @@ typedef struct {
 
   EFI_LOCK                        TaskQueueLock;
   LIST_ENTRY                      TaskQueue;
+
+  //
+  // Optional block cache serving blocking requests that fall within a single block.
+  // CacheBlockNum is zero when the cache is disabled. CacheBlockSize is the block
+  // size the cache buffer was laid out for.
+  //
+  UINT32                          CacheMediaId;
+  UINT32                          CacheBlockSize;
+  UINTN                           CacheBlockNum;
+  UINTN                           CacheBlockStride;
+  DISK_IO_CACHE_ENTRY             *CacheEntries;
+  UINT8                           *CacheBuffer;
+  UINT64                          CacheHits;
+  UINT64                          CacheMisses;
 } DISK_IO_PRIVATE_DATA;
 #define DISK_IO_PRIVATE_DATA_FROM_DISK_IO(a)  CR (a, DISK_IO_PRIVATE_DATA, DiskIo,  DISK_IO_PRIVATE_DATA_SIGNATURE)
 #define DISK_IO_PRIVATE_DATA_FROM_DISK_IO2(a) CR (a, DISK_IO_PRIVATE_DATA, DiskIo2, DISK_IO_PRIVATE_DATA_SIGNATURE)
@@ -469,5 +492,28 @@ DiskIoComponentNameGetControllerName (
   OUT CHAR16                                          **ControllerName
   );
 
+//
+// Block cache
+//
+/**
+  Allocate the optional block cache of the Disk IO instance.
+
+  @param Instance     Pointer to the DISK_IO_PRIVATE_DATA.
+**/
+VOID
+DiskIoInitializeCache (
+  IN DISK_IO_PRIVATE_DATA     *Instance
+  );
+
+/**
+  Free the block cache of the Disk IO instance.
+
+  @param Instance     Pointer to the DISK_IO_PRIVATE_DATA.
+**/
+VOID
+DiskIoFreeCache (
+  IN DISK_IO_PRIVATE_DATA     *Instance
+  );
+
 
 #endif
@@ -38,6 +38,8 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
   @param[in]  DiskIo      Disk Io protocol.
   @param[in]  Lba         The starting Lba of the Partition Table
   @param[out] PartHeader  Stores the partition table that is read
+  @param[out] PartEntry   If not NULL, receives the validated partition entry
+                          array when the table is valid. The caller frees it.
 
   @retval TRUE      The partition table is valid
   @retval FALSE     The partition table is not valid
@@ -48,7 +50,8 @@ PartitionValidGptTable (
   IN  EFI_BLOCK_IO_PROTOCOL       *BlockIo,
   IN  EFI_DISK_IO_PROTOCOL        *DiskIo,
   IN  EFI_LBA                     Lba,
-  OUT EFI_PARTITION_TABLE_HEADER  *PartHeader
+  OUT EFI_PARTITION_TABLE_HEADER  *PartHeader,
+  OUT EFI_PARTITION_ENTRY         **PartEntry OPTIONAL
   );
 
 /**
@@ -58,6 +61,8 @@ PartitionValidGptTable (
   @param[in]  BlockIo     Parent BlockIo interface
   @param[in]  DiskIo      Disk Io Protocol.
   @param[in]  PartHeader  Partition table header structure
+  @param[out] PartEntry   If not NULL, receives the partition entry array
+                          when the CRC is valid. The caller frees it.
 
   @retval TRUE      the CRC is valid
   @retval FALSE     the CRC is invalid
@@ -67,7 +72,8 @@ BOOLEAN
 PartitionCheckGptEntryArrayCRC (
   IN  EFI_BLOCK_IO_PROTOCOL       *BlockIo,
   IN  EFI_DISK_IO_PROTOCOL        *DiskIo,
-  IN  EFI_PARTITION_TABLE_HEADER  *PartHeader
+  IN  EFI_PARTITION_TABLE_HEADER  *PartHeader,
+  OUT EFI_PARTITION_ENTRY         **PartEntry OPTIONAL
   );
 
 
@@ -288,10 +294,10 @@ PartitionInstallGptChildHandles (
   //
   // Check primary and backup partition tables
   //
-  if (!PartitionValidGptTable (BlockIo, DiskIo, PRIMARY_PART_HEADER_LBA, PrimaryHeader)) {
+  if (!PartitionValidGptTable (BlockIo, DiskIo, PRIMARY_PART_HEADER_LBA, PrimaryHeader, &PartEntry)) {
     DEBUG ((EFI_D_INFO, " Not Valid primary partition table\n"));
 
-    if (!PartitionValidGptTable (BlockIo, DiskIo, LastBlock, BackupHeader)) {
+    if (!PartitionValidGptTable (BlockIo, DiskIo, LastBlock, BackupHeader, NULL)) {
       DEBUG ((EFI_D_INFO, " Not Valid backup partition table\n"));
       goto Done;
     } else {
@@ -301,18 +307,18 @@ PartitionInstallGptChildHandles (
         DEBUG ((EFI_D_INFO, " Restore primary partition table error\n"));
       }
 
-      if (PartitionValidGptTable (BlockIo, DiskIo, BackupHeader->AlternateLBA, PrimaryHeader)) {
+      if (PartitionValidGptTable (BlockIo, DiskIo, BackupHeader->AlternateLBA, PrimaryHeader, &PartEntry)) {
         DEBUG ((EFI_D_INFO, " Restore backup partition table success\n"));
       }
     }
-  } else if (!PartitionValidGptTable (BlockIo, DiskIo, PrimaryHeader->AlternateLBA, BackupHeader)) {
+  } else if (!PartitionValidGptTable (BlockIo, DiskIo, PrimaryHeader->AlternateLBA, BackupHeader, NULL)) {
     DEBUG ((EFI_D_INFO, " Valid primary and !Valid backup partition table\n"));
     DEBUG ((EFI_D_INFO, " Restore backup partition table by the primary\n"));
     if (!PartitionRestoreGptTable (BlockIo, DiskIo, PrimaryHeader)) {
       DEBUG ((EFI_D_INFO, " Restore backup partition table error\n"));
     }
 
-    if (PartitionValidGptTable (BlockIo, DiskIo, PrimaryHeader->AlternateLBA, BackupHeader)) {
+    if (PartitionValidGptTable (BlockIo, DiskIo, PrimaryHeader->AlternateLBA, BackupHeader, NULL)) {
       DEBUG ((EFI_D_INFO, " Restore backup partition table success\n"));
     }
 
@@ -321,25 +327,28 @@ PartitionInstallGptChildHandles (
   DEBUG ((EFI_D_INFO, " Valid primary and Valid backup partition table\n"));
 
   //
-  // Read the EFI Partition Entries
+  // Read the EFI Partition Entries, unless validating the primary partition
+  // table already returned them.
   //
-  PartEntry = AllocatePool (PrimaryHeader->NumberOfPartitionEntries * PrimaryHeader->SizeOfPartitionEntry);
   if (PartEntry == NULL) {
-    DEBUG ((EFI_D_ERROR, "Allocate pool error\n"));
-    goto Done;
-  }
+    PartEntry = AllocatePool (PrimaryHeader->NumberOfPartitionEntries * PrimaryHeader->SizeOfPartitionEntry);
+    if (PartEntry == NULL) {
+      DEBUG ((EFI_D_ERROR, "Allocate pool error\n"));
+      goto Done;
+    }
 
-  Status = DiskIo->ReadDisk (
-                     DiskIo,
-                     MediaId,
-                     MultU64x32(PrimaryHeader->PartitionEntryLBA, BlockSize),
-                     PrimaryHeader->NumberOfPartitionEntries * (PrimaryHeader->SizeOfPartitionEntry),
-                     PartEntry
-                     );
-  if (EFI_ERROR (Status)) {
-    GptValidStatus = Status;
-    DEBUG ((EFI_D_ERROR, " Partition Entry ReadDisk error\n"));
-    goto Done;
+    Status = DiskIo->ReadDisk (
+                       DiskIo,
+                       MediaId,
+                       MultU64x32(PrimaryHeader->PartitionEntryLBA, BlockSize),
+                       PrimaryHeader->NumberOfPartitionEntries * (PrimaryHeader->SizeOfPartitionEntry),
+                       PartEntry
+                       );
+    if (EFI_ERROR (Status)) {
+      GptValidStatus = Status;
+      DEBUG ((EFI_D_ERROR, " Partition Entry ReadDisk error\n"));
+      goto Done;
+    }
   }
 
   DEBUG ((EFI_D_INFO, " Partition entries read block success\n"));
@@ -447,6 +456,8 @@ Done:
   @param[in]  DiskIo      Disk Io protocol.
   @param[in]  Lba         The starting Lba of the Partition Table
   @param[out] PartHeader  Stores the partition table that is read
+  @param[out] PartEntry   If not NULL, receives the validated partition entry
+                          array when the table is valid. The caller frees it.
 
   @retval TRUE      The partition table is valid
   @retval FALSE     The partition table is not valid
@@ -457,7 +468,8 @@ PartitionValidGptTable (
   IN  EFI_BLOCK_IO_PROTOCOL       *BlockIo,
   IN  EFI_DISK_IO_PROTOCOL        *DiskIo,
   IN  EFI_LBA                     Lba,
-  OUT EFI_PARTITION_TABLE_HEADER  *PartHeader
+  OUT EFI_PARTITION_TABLE_HEADER  *PartHeader,
+  OUT EFI_PARTITION_ENTRY         **PartEntry OPTIONAL
   )
 {
   EFI_STATUS                  Status;
@@ -507,7 +519,7 @@ PartitionValidGptTable (
   }
 
   CopyMem (PartHeader, PartHdr, sizeof (EFI_PARTITION_TABLE_HEADER));
-  if (!PartitionCheckGptEntryArrayCRC (BlockIo, DiskIo, PartHeader)) {
+  if (!PartitionCheckGptEntryArrayCRC (BlockIo, DiskIo, PartHeader, PartEntry)) {
     FreePool (PartHdr);
     return FALSE;
   }
@@ -524,6 +536,8 @@ PartitionValidGptTable (
   @param[in]  BlockIo     Parent BlockIo interface
   @param[in]  DiskIo      Disk Io Protocol.
   @param[in]  PartHeader  Partition table header structure
+  @param[out] PartEntry   If not NULL, receives the partition entry array
+                          when the CRC is valid. The caller frees it.
 
   @retval TRUE      the CRC is valid
   @retval FALSE     the CRC is invalid
@@ -533,7 +547,8 @@ BOOLEAN
 PartitionCheckGptEntryArrayCRC (
   IN  EFI_BLOCK_IO_PROTOCOL       *BlockIo,
   IN  EFI_DISK_IO_PROTOCOL        *DiskIo,
-  IN  EFI_PARTITION_TABLE_HEADER  *PartHeader
+  IN  EFI_PARTITION_TABLE_HEADER  *PartHeader,
+  OUT EFI_PARTITION_ENTRY         **PartEntry OPTIONAL
   )
 {
   EFI_STATUS  Status;
@@ -571,6 +586,17 @@ PartitionCheckGptEntryArrayCRC (
     return FALSE;
   }
 
+  if ((PartEntry != NULL) && (PartHeader->PartitionEntryArrayCRC32 == Crc)) {
+    //
+    // Hand the validated entry array to the caller so it is not read twice.
+    //
+    if (*PartEntry != NULL) {
+      FreePool (*PartEntry);
+    }
+    *PartEntry = (EFI_PARTITION_ENTRY *) Ptr;
+    return TRUE;
+  }
+
   FreePool (Ptr);
 
   return (BOOLEAN) (PartHeader->PartitionEntryArrayCRC32 == Crc);
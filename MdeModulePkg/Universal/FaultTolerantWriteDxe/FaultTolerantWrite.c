@@ -338,6 +338,7 @@ FtwWrite (
   UINTN                               NumberOfBlocks;
   UINTN                               NumberOfWriteBlocks;
   UINTN                               WriteLength;
+  UINTN                               NumberOfSpareBlocks;
 
   FtwDevice = FTW_CONTEXT_FROM_THIS (This);
 
@@ -436,6 +437,17 @@ FtwWrite (
     //
     ASSERT ((BlockSize == FtwDevice->SpareBlockSize) && (NumberOfWriteBlocks == FtwDevice->NumberOfSpareBlock));
   }
+
+  //
+  // Working block and boot block updates flush the whole spare area. Other
+  // targets only use as many spare blocks as the write needs, so only those
+  // are backed up, erased and restored.
+  //
+  if (IsWorkingBlock (FtwDevice, Fvb, Lba) || IsBootBlock (FtwDevice, Fvb)) {
+    NumberOfSpareBlocks = FtwDevice->NumberOfSpareBlock;
+  } else {
+    NumberOfSpareBlocks = FTW_BLOCKS (WriteLength, FtwDevice->SpareBlockSize);
+  }
   //
   // Write the record to the work space.
   //
@@ -496,7 +508,7 @@ FtwWrite (
   // Try to keep the content of spare block
   // Save spare block into a spare backup memory buffer (Sparebuffer)
   //
-  SpareBufferSize = FtwDevice->SpareAreaLength;
+  SpareBufferSize = NumberOfSpareBlocks * FtwDevice->SpareBlockSize;
   SpareBuffer     = AllocatePool (SpareBufferSize);
   if (SpareBuffer == NULL) {
     FreePool (MyBuffer);
@@ -504,7 +516,7 @@ FtwWrite (
   }
 
   Ptr = SpareBuffer;
-  for (Index = 0; Index < FtwDevice->NumberOfSpareBlock; Index += 1) {
+  for (Index = 0; Index < NumberOfSpareBlocks; Index += 1) {
     MyLength = FtwDevice->SpareBlockSize;
     Status = FtwDevice->FtwBackupFvb->Read (
                                         FtwDevice->FtwBackupFvb,
@@ -525,7 +537,7 @@ FtwWrite (
   // Write the memory buffer to spare block
   // Do not assume Spare Block and Target Block have same block size
   //
-  Status  = FtwEraseSpareBlock (FtwDevice);
+  Status  = FtwEraseBlock (FtwDevice, FtwDevice->FtwBackupFvb, FtwDevice->FtwSpareLba, NumberOfSpareBlocks);
   Ptr     = MyBuffer;
   for (Index = 0; MyBufferSize > 0; Index += 1) {
     if (MyBufferSize > FtwDevice->SpareBlockSize) {
@@ -583,11 +595,16 @@ FtwWrite (
   }
   //
   // Restore spare backup buffer into spare block , if no failure happened during FtwWrite.
+  // Blocks that were erased before the write need no programming after the erase.
   //
-  Status  = FtwEraseSpareBlock (FtwDevice);
+  Status  = FtwEraseBlock (FtwDevice, FtwDevice->FtwBackupFvb, FtwDevice->FtwSpareLba, NumberOfSpareBlocks);
   Ptr     = SpareBuffer;
-  for (Index = 0; Index < FtwDevice->NumberOfSpareBlock; Index += 1) {
+  for (Index = 0; Index < NumberOfSpareBlocks; Index += 1) {
     MyLength = FtwDevice->SpareBlockSize;
+    if (IsErasedFlashBuffer (Ptr, MyLength)) {
+      Ptr += MyLength;
+      continue;
+    }
     Status = FtwDevice->FtwBackupFvb->Write (
                                         FtwDevice->FtwBackupFvb,
                                         FtwDevice->FtwSpareLba + Index,
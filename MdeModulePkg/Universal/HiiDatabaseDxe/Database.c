@@ -871,6 +871,7 @@ Error:
 
   if (StringPackage != NULL) {
     if (StringPackage->StringBlock != NULL) {
+      InvalidateStringBlockIndex (StringPackage);
       FreePool (StringPackage->StringBlock);
     }
     if (StringPackage->StringPkgHdr != NULL) {
@@ -949,6 +950,7 @@ AdjustStringPackage (
       // Append a EFI_HII_SIBT_END block to the end.
       //
       *BlockPtr = EFI_HII_SIBT_END;
+      InvalidateStringBlockIndex (StringPackage);
       FreePool (StringPackage->StringBlock);
       StringPackage->StringBlock = StringBlock;
       StringPackage->StringPkgHdr->Header.Length += Skip2BlockSize;
@@ -1090,6 +1092,7 @@ RemoveStringPackages (
 
     RemoveEntryList (&Package->StringEntry);
     PackageList->PackageListHdr.PackageLength -= Package->StringPkgHdr->Header.Length;
+    InvalidateStringBlockIndex (Package);
     FreePool (Package->StringBlock);
     FreePool (Package->StringPkgHdr);
     //
@@ -1912,6 +1915,9 @@ RemoveSimpleFontPackages (
 
     RemoveEntryList (&Package->SimpleFontEntry);
     PackageList->PackageListHdr.PackageLength -= Package->SimpleFontPkgHdr->Header.Length;
+    if (Package->GlyphIndex != NULL) {
+      FreePool (Package->GlyphIndex);
+    }
     FreePool (Package->SimpleFontPkgHdr);
     FreePool (Package);
   }
@@ -136,6 +136,121 @@ GetCell (
 }
 
 
+/**
+  Find the glyph of a character in a simple font package.
+
+  The narrow glyphs, then the wide glyphs, of the package are entered into a
+  hash table the first time the package is searched, so that the per character
+  lookups done while rendering console text do not scan the glyph arrays.
+  When a character appears more than once the first glyph found by a linear
+  scan is returned.  If the table can not be allocated the arrays are scanned.
+
+  This is a internal function.
+
+  @param  SimpleFont              The simple font package instance.
+  @param  Char                    Character to find.
+  @param  Index                   Index of the glyph in the narrow or wide glyph array.
+  @param  GlyphType               NARROW_GLYPH or EFI_GLYPH_WIDE.
+
+  @retval EFI_SUCCESS             The glyph is found.
+  @retval EFI_NOT_FOUND           The package has no glyph for the character.
+
+**/
+EFI_STATUS
+FindSimpleFontGlyph (
+  IN  HII_SIMPLE_FONT_PACKAGE_INSTANCE  *SimpleFont,
+  IN  CHAR16                            Char,
+  OUT UINT16                            *Index,
+  OUT UINT8                             *GlyphType
+  )
+{
+  EFI_NARROW_GLYPH                   *NarrowPtr;
+  EFI_WIDE_GLYPH                     *WidePtr;
+  UINT16                             NumberOfNarrowGlyphs;
+  UINT16                             NumberOfWideGlyphs;
+  UINTN                              Count;
+  UINTN                              Slot;
+  UINTN                              Position;
+  UINT16                             Item;
+  CHAR16                             UnicodeWeight;
+  UINT8                              Type;
+
+  NumberOfNarrowGlyphs = SimpleFont->SimpleFontPkgHdr->NumberOfNarrowGlyphs;
+  NumberOfWideGlyphs   = SimpleFont->SimpleFontPkgHdr->NumberOfWideGlyphs;
+  NarrowPtr = (EFI_NARROW_GLYPH *) ((UINT8 *) (SimpleFont->SimpleFontPkgHdr) + sizeof (EFI_HII_SIMPLE_FONT_PACKAGE_HDR));
+  WidePtr   = (EFI_WIDE_GLYPH *) (NarrowPtr + NumberOfNarrowGlyphs);
+
+  if (SimpleFont->GlyphIndex == NULL) {
+    //
+    // Size the table to at least twice the number of glyphs, as a power of 2.
+    //
+    Count = (UINTN) NumberOfNarrowGlyphs + NumberOfWideGlyphs;
+    SimpleFont->GlyphIndexSize = 16;
+    while (SimpleFont->GlyphIndexSize < 2 * Count) {
+      SimpleFont->GlyphIndexSize <<= 1;
+    }
+    SimpleFont->GlyphIndex = AllocateZeroPool (SimpleFont->GlyphIndexSize * sizeof (HII_SIMPLE_GLYPH_INDEX));
+
+    if (SimpleFont->GlyphIndex != NULL) {
+      for (Position = 0; Position < Count; Position++) {
+        if (Position < NumberOfNarrowGlyphs) {
+          Item = (UINT16) Position;
+          Type = NARROW_GLYPH;
+          CopyMem (&UnicodeWeight, &NarrowPtr[Item].UnicodeWeight, sizeof (CHAR16));
+        } else {
+          Item = (UINT16) (Position - NumberOfNarrowGlyphs);
+          Type = EFI_GLYPH_WIDE;
+          CopyMem (&UnicodeWeight, &WidePtr[Item].UnicodeWeight, sizeof (CHAR16));
+        }
+
+        Slot = UnicodeWeight & (SimpleFont->GlyphIndexSize - 1);
+        while (SimpleFont->GlyphIndex[Slot].Type != 0 &&
+               SimpleFont->GlyphIndex[Slot].UnicodeWeight != UnicodeWeight) {
+          Slot = (Slot + 1) & (SimpleFont->GlyphIndexSize - 1);
+        }
+        if (SimpleFont->GlyphIndex[Slot].Type == 0) {
+          SimpleFont->GlyphIndex[Slot].UnicodeWeight = UnicodeWeight;
+          SimpleFont->GlyphIndex[Slot].Index         = Item;
+          SimpleFont->GlyphIndex[Slot].Type          = Type;
+        }
+      }
+    }
+  }
+
+  if (SimpleFont->GlyphIndex != NULL) {
+    Slot = Char & (SimpleFont->GlyphIndexSize - 1);
+    while (SimpleFont->GlyphIndex[Slot].Type != 0) {
+      if (SimpleFont->GlyphIndex[Slot].UnicodeWeight == Char) {
+        *Index     = SimpleFont->GlyphIndex[Slot].Index;
+        *GlyphType = SimpleFont->GlyphIndex[Slot].Type;
+        return EFI_SUCCESS;
+      }
+      Slot = (Slot + 1) & (SimpleFont->GlyphIndexSize - 1);
+    }
+    return EFI_NOT_FOUND;
+  }
+
+  for (Item = 0; Item < NumberOfNarrowGlyphs; Item++) {
+    CopyMem (&UnicodeWeight, &NarrowPtr[Item].UnicodeWeight, sizeof (CHAR16));
+    if (UnicodeWeight == Char) {
+      *Index     = Item;
+      *GlyphType = NARROW_GLYPH;
+      return EFI_SUCCESS;
+    }
+  }
+  for (Item = 0; Item < NumberOfWideGlyphs; Item++) {
+    CopyMem (&UnicodeWeight, &WidePtr[Item].UnicodeWeight, sizeof (CHAR16));
+    if (UnicodeWeight == Char) {
+      *Index     = Item;
+      *GlyphType = EFI_GLYPH_WIDE;
+      return EFI_SUCCESS;
+    }
+  }
+
+  return EFI_NOT_FOUND;
+}
+
+
 /**
   Convert the glyph for a single character into a bitmap.
 
@@ -177,6 +292,7 @@ GetGlyphBuffer (
   UINTN                              HeaderSize;
   EFI_NARROW_GLYPH                   *NarrowPtr;
   EFI_WIDE_GLYPH                     *WidePtr;
+  UINT8                              GlyphType;
 
   if (GlyphBuffer == NULL || Cell == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -211,49 +327,42 @@ GetGlyphBuffer (
            Link1 = Link1->ForwardLink
           ) {
         SimpleFont = CR (Link1, HII_SIMPLE_FONT_PACKAGE_INSTANCE, SimpleFontEntry, HII_S_FONT_PACKAGE_SIGNATURE);
-        //
-        // Search the narrow glyph array
-        //
+        if (EFI_ERROR (FindSimpleFontGlyph (SimpleFont, Char, &Index, &GlyphType))) {
+          continue;
+        }
+
         NarrowPtr = (EFI_NARROW_GLYPH *) ((UINT8 *) (SimpleFont->SimpleFontPkgHdr) + HeaderSize);
-        for (Index = 0; Index < SimpleFont->SimpleFontPkgHdr->NumberOfNarrowGlyphs; Index++) {
+        if (GlyphType == NARROW_GLYPH) {
           CopyMem (&Narrow, NarrowPtr + Index,sizeof (EFI_NARROW_GLYPH));
-          if (Narrow.UnicodeWeight == Char) {
-            *GlyphBuffer = (UINT8 *) AllocateZeroPool (EFI_GLYPH_HEIGHT);
-            if (*GlyphBuffer == NULL) {
-              return EFI_OUT_OF_RESOURCES;
-            }
-            Cell->Width    = EFI_GLYPH_WIDTH;
-            Cell->Height   = EFI_GLYPH_HEIGHT;
-            Cell->AdvanceX = Cell->Width;
-            CopyMem (*GlyphBuffer, Narrow.GlyphCol1, Cell->Height);
-            if (Attributes != NULL) {
-              *Attributes = (UINT8) (Narrow.Attributes | NARROW_GLYPH);
-            }
-            return EFI_SUCCESS;
+          *GlyphBuffer = (UINT8 *) AllocateZeroPool (EFI_GLYPH_HEIGHT);
+          if (*GlyphBuffer == NULL) {
+            return EFI_OUT_OF_RESOURCES;
+          }
+          Cell->Width    = EFI_GLYPH_WIDTH;
+          Cell->Height   = EFI_GLYPH_HEIGHT;
+          Cell->AdvanceX = Cell->Width;
+          CopyMem (*GlyphBuffer, Narrow.GlyphCol1, Cell->Height);
+          if (Attributes != NULL) {
+            *Attributes = (UINT8) (Narrow.Attributes | NARROW_GLYPH);
           }
+          return EFI_SUCCESS;
         }
-        //
-        // Search the wide glyph array
-        //
+
         WidePtr = (EFI_WIDE_GLYPH *) (NarrowPtr + SimpleFont->SimpleFontPkgHdr->NumberOfNarrowGlyphs);
-        for (Index = 0; Index < SimpleFont->SimpleFontPkgHdr->NumberOfWideGlyphs; Index++) {
-          CopyMem (&Wide, WidePtr + Index, sizeof (EFI_WIDE_GLYPH));
-          if (Wide.UnicodeWeight == Char) {
-            *GlyphBuffer    = (UINT8 *) AllocateZeroPool (EFI_GLYPH_HEIGHT * 2);
-            if (*GlyphBuffer == NULL) {
-              return EFI_OUT_OF_RESOURCES;
-            }
-            Cell->Width    = EFI_GLYPH_WIDTH * 2;
-            Cell->Height   = EFI_GLYPH_HEIGHT;
-            Cell->AdvanceX = Cell->Width;
-            CopyMem (*GlyphBuffer, Wide.GlyphCol1, EFI_GLYPH_HEIGHT);
-            CopyMem (*GlyphBuffer + EFI_GLYPH_HEIGHT, Wide.GlyphCol2, EFI_GLYPH_HEIGHT);
-            if (Attributes != NULL) {
-              *Attributes = (UINT8) (Wide.Attributes | EFI_GLYPH_WIDE);
-            }
-            return EFI_SUCCESS;
-          }
+        CopyMem (&Wide, WidePtr + Index, sizeof (EFI_WIDE_GLYPH));
+        *GlyphBuffer    = (UINT8 *) AllocateZeroPool (EFI_GLYPH_HEIGHT * 2);
+        if (*GlyphBuffer == NULL) {
+          return EFI_OUT_OF_RESOURCES;
+        }
+        Cell->Width    = EFI_GLYPH_WIDTH * 2;
+        Cell->Height   = EFI_GLYPH_HEIGHT;
+        Cell->AdvanceX = Cell->Width;
+        CopyMem (*GlyphBuffer, Wide.GlyphCol1, EFI_GLYPH_HEIGHT);
+        CopyMem (*GlyphBuffer + EFI_GLYPH_HEIGHT, Wide.GlyphCol2, EFI_GLYPH_HEIGHT);
+        if (Attributes != NULL) {
+          *Attributes = (UINT8) (Wide.Attributes | EFI_GLYPH_WIDE);
         }
+        return EFI_SUCCESS;
       }
     }
   }
@@ -127,6 +127,15 @@ typedef struct {
 // String Package definitions
 //
 #define HII_STRING_PACKAGE_SIGNATURE    SIGNATURE_32 ('h','i','s','p')
+
+//
+// Location of a string found by FindStringBlock(), cached per StringId.
+//
+typedef struct {
+  UINT32                                BlockOffset;   // offset of the string block from StringBlock
+  UINT32                                TextOffset;    // offset of the string text from the block, 0 if not cached
+} HII_STRING_BLOCK_INDEX;
+
 typedef struct _HII_STRING_PACKAGE_INSTANCE {
   UINTN                                 Signature;
   EFI_HII_STRING_PACKAGE_HDR            *StringPkgHdr;
@@ -135,6 +144,8 @@ typedef struct _HII_STRING_PACKAGE_INSTANCE {
   LIST_ENTRY                            FontInfoList;  // local font info list
   UINT8                                 FontId;
   EFI_STRING_ID                         MaxStringId;   // record StringId
+  HII_STRING_BLOCK_INDEX                *StringIndex;  // StringId lookup cache, built lazily
+  UINTN                                 StringIndexCount;
 } HII_STRING_PACKAGE_INSTANCE;
 
 //
@@ -152,10 +163,22 @@ typedef struct _HII_IFR_PACKAGE_INSTANCE {
 // Simple Font Package definitions
 //
 #define HII_S_FONT_PACKAGE_SIGNATURE    SIGNATURE_32 ('h','s','f','p')
+
+//
+// Hash table slot mapping a character to its glyph in a simple font package.
+//
+typedef struct {
+  CHAR16                                UnicodeWeight;
+  UINT16                                Index;         // index in the narrow or wide glyph array
+  UINT8                                 Type;          // NARROW_GLYPH, EFI_GLYPH_WIDE or 0 if unused
+} HII_SIMPLE_GLYPH_INDEX;
+
 typedef struct _HII_SIMPLE_FONT_PACKAGE_INSTANCE {
   UINTN                                 Signature;
   EFI_HII_SIMPLE_FONT_PACKAGE_HDR       *SimpleFontPkgHdr;
   LIST_ENTRY                            SimpleFontEntry;
+  HII_SIMPLE_GLYPH_INDEX                *GlyphIndex;   // character lookup table, built lazily
+  UINTN                                 GlyphIndexSize;
 } HII_SIMPLE_FONT_PACKAGE_INSTANCE;
 
 //
@@ -467,6 +490,19 @@ FindStringBlock (
   OUT EFI_STRING_ID                   *StartStringId OPTIONAL
   );
 
+/**
+  Discard the StringId lookup cache of a string package.
+
+  Must be called whenever the string blocks of the package are changed or freed.
+
+  @param  StringPackage           Hii string package instance.
+
+**/
+VOID
+InvalidateStringBlockIndex (
+  IN HII_STRING_PACKAGE_INSTANCE      *StringPackage
+  );
+
 
 /**
   Parse all glyph blocks to find a glyph block specified by CharValue.
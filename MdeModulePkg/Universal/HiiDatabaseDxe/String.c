@@ -232,6 +232,64 @@ GetStringFontInfo (
 }
 
 
+/**
+  Discard the StringId lookup cache of a string package.
+
+  Must be called whenever the string blocks of the package are changed or freed.
+
+  @param  StringPackage           Hii string package instance.
+
+**/
+VOID
+InvalidateStringBlockIndex (
+  IN HII_STRING_PACKAGE_INSTANCE      *StringPackage
+  )
+{
+  if (StringPackage->StringIndex != NULL) {
+    FreePool (StringPackage->StringIndex);
+    StringPackage->StringIndex = NULL;
+  }
+  StringPackage->StringIndexCount = 0;
+}
+
+
+/**
+  Record the location of a string found by FindStringBlock() so that later
+  lookups of the same StringId do not walk the string blocks again.
+
+  The cache is allocated on first use and sized by the current MaxStringId.
+  Failure to allocate it is not an error, lookups simply stay uncached.
+
+  @param  StringPackage           Hii string package instance.
+  @param  StringId                The string's id.
+  @param  StringBlockAddr         The address of the string block holding the string.
+  @param  StringTextOffset        Offset, relative to StringBlockAddr, of the string text.
+
+**/
+STATIC
+VOID
+SaveStringBlockIndex (
+  IN HII_STRING_PACKAGE_INSTANCE      *StringPackage,
+  IN EFI_STRING_ID                    StringId,
+  IN UINT8                            *StringBlockAddr,
+  IN UINTN                            StringTextOffset
+  )
+{
+  if (StringPackage->StringIndex == NULL) {
+    StringPackage->StringIndex = AllocateZeroPool ((StringPackage->MaxStringId + 1) * sizeof (HII_STRING_BLOCK_INDEX));
+    if (StringPackage->StringIndex == NULL) {
+      return;
+    }
+    StringPackage->StringIndexCount = StringPackage->MaxStringId + 1;
+  }
+
+  if (StringId < StringPackage->StringIndexCount) {
+    StringPackage->StringIndex[StringId].BlockOffset = (UINT32) (StringBlockAddr - StringPackage->StringBlock);
+    StringPackage->StringIndex[StringId].TextOffset  = (UINT32) StringTextOffset;
+  }
+}
+
+
 /**
   Parse all string blocks to find a String block specified by StringId.
   If StringId = (EFI_STRING_ID) (-1), find out all EFI_HII_SIBT_FONT blocks
@@ -290,17 +348,36 @@ FindStringBlock (
   UINT32                               Length32;
   UINTN                                StringSize;
   CHAR16                               Zero;
+  EFI_STRING_ID                        RequestedStringId;
+  HII_STRING_BLOCK_INDEX               *IndexEntry;
 
   ASSERT (StringPackage != NULL);
   ASSERT (StringPackage->Signature == HII_STRING_PACKAGE_SIGNATURE);
 
-  CurrentStringId = 1;
+  CurrentStringId   = 1;
+  RequestedStringId = StringId;
 
   if (StringId != (EFI_STRING_ID) (-1) && StringId != 0) {
     ASSERT (BlockType != NULL && StringBlockAddr != NULL && StringTextOffset != NULL);
     if (StringId > StringPackage->MaxStringId) {
       return EFI_NOT_FOUND;
     }
+
+    //
+    // Strings are fetched repeatedly by consoles, the browser and the Shell.
+    // Use the cached location when this string has been found before.
+    // StartStringId is only requested when the blocks are about to be changed,
+    // so those lookups always walk the blocks.
+    //
+    if (StartStringId == NULL && StringId < StringPackage->StringIndexCount) {
+      IndexEntry = &StringPackage->StringIndex[StringId];
+      if (IndexEntry->TextOffset != 0) {
+        *StringBlockAddr  = StringPackage->StringBlock + IndexEntry->BlockOffset;
+        *BlockType        = **StringBlockAddr;
+        *StringTextOffset = IndexEntry->TextOffset;
+        return EFI_SUCCESS;
+      }
+    }
   } else {
     ASSERT (Private != NULL && Private->Signature == HII_DATABASE_PRIVATE_DATA_SIGNATURE);
     if (StringId == 0 && LastStringId != NULL) {
@@ -345,6 +422,7 @@ FindStringBlock (
           *BlockType        = *BlockHdr;
           *StringBlockAddr  = BlockHdr;
           *StringTextOffset = StringTextPtr - BlockHdr;
+          SaveStringBlockIndex (StringPackage, RequestedStringId, BlockHdr, *StringTextOffset);
           return EFI_SUCCESS;
         }
         StringTextPtr = StringTextPtr + AsciiStrSize ((CHAR8 *) StringTextPtr);
@@ -368,6 +446,7 @@ FindStringBlock (
           *BlockType        = *BlockHdr;
           *StringBlockAddr  = BlockHdr;
           *StringTextOffset = StringTextPtr - BlockHdr;
+          SaveStringBlockIndex (StringPackage, RequestedStringId, BlockHdr, *StringTextOffset);
           return EFI_SUCCESS;
         }
         StringTextPtr = StringTextPtr + AsciiStrSize ((CHAR8 *) StringTextPtr);
@@ -412,6 +491,7 @@ FindStringBlock (
           *BlockType        = *BlockHdr;
           *StringBlockAddr  = BlockHdr;
           *StringTextOffset = StringTextPtr - BlockHdr;
+          SaveStringBlockIndex (StringPackage, RequestedStringId, BlockHdr, *StringTextOffset);
           return EFI_SUCCESS;
         }
         StringTextPtr = StringTextPtr + StringSize;
@@ -436,6 +516,7 @@ FindStringBlock (
           *BlockType        = *BlockHdr;
           *StringBlockAddr  = BlockHdr;
           *StringTextOffset = StringTextPtr - BlockHdr;
+          SaveStringBlockIndex (StringPackage, RequestedStringId, BlockHdr, *StringTextOffset);
           return EFI_SUCCESS;
         }
         StringTextPtr = StringTextPtr + StringSize;
@@ -559,6 +640,7 @@ FindStringBlock (
         if(*BlockType == EFI_HII_SIBT_SKIP2 || *BlockType == EFI_HII_SIBT_SKIP1) {
           return EFI_NOT_FOUND;
         } else {
+          SaveStringBlockIndex (StringPackage, RequestedStringId, BlockHdr, Offset);
           return EFI_SUCCESS;
         }
       }
@@ -843,6 +925,7 @@ InsertLackStringBlock (
   } else {
     *BlockType = EFI_HII_SIBT_STRING_UCS2;
   }
+  InvalidateStringBlockIndex (StringPackage);
   FreePool (StringPackage->StringBlock);
   StringPackage->StringBlock = StringBlock;
   StringPackage->StringPkgHdr->Header.Length += NewBlockSize - OldBlockSize;
@@ -1010,6 +1093,7 @@ SetStringWorker (
       TmpSize
       );
 
+    InvalidateStringBlockIndex (StringPackage);
     FreePool (StringPackage->StringBlock);
     StringPackage->StringBlock = Block;
     StringPackage->StringPkgHdr->Header.Length += (UINT32) (BlockSize - OldBlockSize);
@@ -1043,6 +1127,7 @@ SetStringWorker (
       OldBlockSize - (StringTextPtr - StringPackage->StringBlock) - StringSize
       );
 
+    InvalidateStringBlockIndex (StringPackage);
     FreePool (StringPackage->StringBlock);
     StringPackage->StringBlock = Block;
     StringPackage->StringPkgHdr->Header.Length += (UINT32) (BlockSize - OldBlockSize);
@@ -1094,6 +1179,7 @@ SetStringWorker (
 
   CopyMem (BlockPtr, StringPackage->StringBlock, OldBlockSize);
 
+  InvalidateStringBlockIndex (StringPackage);
   FreePool (StringPackage->StringBlock);
   StringPackage->StringBlock = Block;
   StringPackage->StringPkgHdr->Header.Length += Ext2.Length;
@@ -1277,6 +1363,7 @@ HiiNewString (
       // Append a EFI_HII_SIBT_END block to the end.
       //
       *BlockPtr = EFI_HII_SIBT_END;
+      InvalidateStringBlockIndex (StringPackage);
       FreePool (StringPackage->StringBlock);
       StringPackage->StringBlock = StringBlock;
       StringPackage->StringPkgHdr->Header.Length += Ucs2BlockSize;
@@ -1408,6 +1495,7 @@ HiiNewString (
     // Append a EFI_HII_SIBT_END block to the end.
     //
     *BlockPtr = EFI_HII_SIBT_END;
+    InvalidateStringBlockIndex (StringPackage);
     FreePool (StringPackage->StringBlock);
     StringPackage->StringBlock = StringBlock;
     StringPackage->StringPkgHdr->Header.Length += Ucs2BlockSize;
@@ -1450,6 +1538,7 @@ HiiNewString (
       // Append a EFI_HII_SIBT_END block to the end.
       //
       *BlockPtr = EFI_HII_SIBT_END;
+      InvalidateStringBlockIndex (StringPackage);
       FreePool (StringPackage->StringBlock);
       StringPackage->StringBlock = StringBlock;
       StringPackage->StringPkgHdr->Header.Length += Ucs2FontBlockSize;
@@ -1511,6 +1600,7 @@ HiiNewString (
       // Append a EFI_HII_SIBT_END block to the end.
       //
       *BlockPtr = EFI_HII_SIBT_END;
+      InvalidateStringBlockIndex (StringPackage);
       FreePool (StringPackage->StringBlock);
       StringPackage->StringBlock = StringBlock;
       StringPackage->StringPkgHdr->Header.Length += FontBlockSize + Ucs2FontBlockSize;
@@ -1554,6 +1644,7 @@ Done:
     // Free the allocated new string Package when new string can't be added.
     //
     RemoveEntryList (&StringPackage->StringEntry);
+    InvalidateStringBlockIndex (StringPackage);
     FreePool (StringPackage->StringBlock);
     FreePool (StringPackage->StringPkgHdr);
     FreePool (StringPackage);
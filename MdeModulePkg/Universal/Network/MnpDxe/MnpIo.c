@@ -1141,17 +1141,28 @@ MnpSystemPoll (
   )
 {
   MNP_DEVICE_DATA  *MnpDeviceData;
+  EFI_STATUS       Status;
+  UINTN            Count;
 
   MnpDeviceData = (MNP_DEVICE_DATA *) Context;
   NET_CHECK_SIGNATURE (MnpDeviceData, MNP_DEVICE_DATA_SIGNATURE);
 
   //
-  // Try to receive packets from Snp.
+  // Try to receive packets from Snp. Drain the packets queued in Snp
+  // since the last poll, up to MNP_MAX_RECEIVE_PER_POLL, so that bursts
+  // don't overflow the receive ring of the network device between polls.
   //
-  MnpReceivePacket (MnpDeviceData);
+  for (Count = 0; Count < MNP_MAX_RECEIVE_PER_POLL; Count++) {
+    Status = MnpReceivePacket (MnpDeviceData);
 
-  //
-  // Dispatch the DPC queued by the NotifyFunction of rx token's events.
-  //
-  DispatchDpc ();
+    //
+    // Dispatch the DPC queued by the NotifyFunction of rx token's events,
+    // the receivers get the chance to queue new rx tokens.
+    //
+    DispatchDpc ();
+
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+  }
 }
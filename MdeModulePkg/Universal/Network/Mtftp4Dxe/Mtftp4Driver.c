@@ -713,6 +713,10 @@ Mtftp4ServiceBindingDestroyChild (
   Mtftp4CleanOperation (Instance, EFI_DEVICE_ERROR);
   UdpIoFreeIo (Instance->UnicastPort);
 
+  if (Instance->RcvBuffer != NULL) {
+    FreePool (Instance->RcvBuffer);
+  }
+
   RemoveEntryList (&Instance->Link);
   MtftpSb->ChildrenNum--;
 
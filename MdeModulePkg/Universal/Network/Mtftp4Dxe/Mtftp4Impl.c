@@ -81,6 +81,10 @@ Mtftp4CleanOperation (
 
   Instance->BlkSize       = MTFTP4_DEFAULT_BLKSIZE;
   Instance->LastBlock     = 0;
+  Instance->WindowSize    = MTFTP4_DEFAULT_WINDOWSIZE;
+  Instance->TotalBlock    = 0;
+  Instance->AckedBlock    = 0;
+  Instance->GapAckBlock   = -1;
   Instance->ServerIp      = 0;
   Instance->ListeningPort = 0;
   Instance->ConnectedPort = 0;
@@ -349,6 +353,7 @@ Mtftp4ConfigUnicastPort (
   @param  Operation              The operation to do
 
   @retval EFI_INVALID_PARAMETER  Some of the parameters are invalid.
+  @retval EFI_UNSUPPORTED        The windowsize option is requested for a write.
   @retval EFI_NOT_STARTED        The MTFTP session hasn't been configured.
   @retval EFI_ALREADY_STARTED    There is pending operation for the session.
   @retval EFI_SUCCESS            The operation is successfully started.
@@ -432,6 +437,15 @@ Mtftp4Start (
     if (EFI_ERROR (Status)) {
       goto ON_ERROR;
     }
+
+    //
+    // Uploads are always sent one block per ACK.
+    //
+    if ((Operation == EFI_MTFTP4_OPCODE_WRQ) &&
+        ((Instance->RequestOption.Exist & MTFTP4_WINDOWSIZE_EXIST) != 0)) {
+      Status = EFI_UNSUPPORTED;
+      goto ON_ERROR;
+    }
   }
 
   //
@@ -440,6 +454,8 @@ Mtftp4Start (
   Config                  = &Instance->Config;
   Instance->Token         = Token;
   Instance->BlkSize       = MTFTP4_DEFAULT_BLKSIZE;
+  Instance->WindowSize    = MTFTP4_DEFAULT_WINDOWSIZE;
+  Instance->GapAckBlock   = -1;
 
   CopyMem (&Instance->ServerIp, &Config->ServerIp, sizeof (IP4_ADDR));
   Instance->ServerIp      = NTOHL (Instance->ServerIp);
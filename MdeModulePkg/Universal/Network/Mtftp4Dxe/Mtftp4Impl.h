@@ -56,6 +56,8 @@ typedef struct _MTFTP4_PROTOCOL MTFTP4_PROTOCOL;
 #define MTFTP4_DEFAULT_TIMEOUT      3
 #define MTFTP4_DEFAULT_RETRY        5
 #define MTFTP4_DEFAULT_BLKSIZE      512
+#define MTFTP4_DEFAULT_WINDOWSIZE   1
+#define MTFTP4_MAX_WINDOWSIZE       64
 #define MTFTP4_TIME_TO_GETMAP       5
 
 #define MTFTP4_STATE_UNCONFIGED     0
@@ -120,6 +122,21 @@ struct _MTFTP4_PROTOCOL {
   UINT16                        LastBlock;
   LIST_ENTRY                    Blocks;
 
+  //
+  // Number of blocks the server sends before waiting for an ACK, the
+  // continuous number of the last block received and the last block ACKed.
+  //
+  UINT16                        WindowSize;
+  UINT64                        TotalBlock;
+  UINT64                        AckedBlock;
+
+  //
+  // The expected block for which an out of order ACK has been sent, or -1.
+  // Later out of order blocks for the same gap are dropped silently. Reset
+  // to -1 once a block is saved in order.
+  //
+  INTN                          GapAckBlock;
+
   //
   // The server's communication end point: IP and two ports. one for
   // initial request, one for its selected port.
@@ -146,6 +163,13 @@ struct _MTFTP4_PROTOCOL {
   UINT16                        McastPort;
   BOOLEAN                       Master;
   UDP_IO                        *McastUdpPort;
+
+  //
+  // Buffer used to make received packets continuous. It is kept
+  // for the life of the instance and only grown when needed.
+  //
+  UINT8                         *RcvBuffer;
+  UINT32                        RcvBufferSize;
 };
 
 typedef struct {
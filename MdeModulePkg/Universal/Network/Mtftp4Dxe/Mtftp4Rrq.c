@@ -115,6 +115,8 @@ Mtftp4RrqSendAck (
   Ack->Ack.OpCode   = HTONS (EFI_MTFTP4_OPCODE_ACK);
   Ack->Ack.Block[0] = HTONS (BlkNo);
 
+  Instance->AckedBlock = Instance->TotalBlock;
+
   return Mtftp4SendPacket (Instance, Packet);
 }
 
@@ -178,6 +180,8 @@ Mtftp4RrqSaveBlock (
     return Status;
   }
 
+  Instance->TotalBlock = TotalBlock;
+
   if (Token->CheckPacket != NULL) {
     Status = Token->CheckPacket (&Instance->Mtftp4, Token, (UINT16) Len, Packet);
 
@@ -263,12 +267,20 @@ Mtftp4RrqHandleData (
   ASSERT (Expected >= 0);
 
   //
-  // If we are active and received an unexpected packet, retransmit
-  // the last ACK then restart receiving. If we are passive, save
-  // the block.
+  // If we are active and received an unexpected packet, ACK the last
+  // block received in order so that the server restarts its window
+  // from the expected block. The ACK is sent once per gap: the later
+  // out of order blocks are dropped until the expected block arrives,
+  // or the timer retransmits the ACK. Answering each of them would make
+  // the server restart its window again and again. If we are passive,
+  // save the block.
   //
   if (Instance->Master && (Expected != BlockNum)) {
-    Mtftp4Retransmit (Instance);
+    if (Instance->GapAckBlock != Expected) {
+      Instance->GapAckBlock = Expected;
+      Mtftp4RrqSendAck (Instance, (UINT16) (Expected - 1));
+    }
+
     return EFI_SUCCESS;
   }
 
@@ -278,6 +290,11 @@ Mtftp4RrqHandleData (
     return Status;
   }
 
+  //
+  // The gap, if any, is closed, so that a later gap is ACKed again.
+  //
+  Instance->GapAckBlock = -1;
+
   //
   // Reset the passive client's timer whenever it received a
   // valid data packet.
@@ -309,7 +326,13 @@ Mtftp4RrqHandleData (
       BlockNum = (UINT16) (Expected - 1);
     }
 
-    Mtftp4RrqSendAck (Instance, BlockNum);
+    //
+    // With a negotiated window, only the last block of each window
+    // and the last block of the file are ACKed.
+    //
+    if ((Expected < 0) || (Instance->TotalBlock - Instance->AckedBlock >= Instance->WindowSize)) {
+      Mtftp4RrqSendAck (Instance, BlockNum);
+    }
   }
 
   return EFI_SUCCESS;
@@ -324,6 +347,7 @@ Mtftp4RrqHandleData (
   2. The server can only use smaller blksize than that is requested
   3. The server can only use the same timeout as requested
   4. The server doesn't change its multicast channel.
+  5. The server can only use smaller windowsize than that is requested
 
   @param  This                  The downloading Mtftp session
   @param  Reply                 The options in the OACK packet
@@ -353,7 +377,8 @@ Mtftp4RrqOackValid (
   // return the timeout matches that requested.
   //
   if ((((Reply->Exist & MTFTP4_BLKSIZE_EXIST) != 0)&& (Reply->BlkSize > Request->BlkSize)) ||
-      (((Reply->Exist & MTFTP4_TIMEOUT_EXIST) != 0) && (Reply->Timeout != Request->Timeout))) {
+      (((Reply->Exist & MTFTP4_TIMEOUT_EXIST) != 0) && (Reply->Timeout != Request->Timeout)) ||
+      (((Reply->Exist & MTFTP4_WINDOWSIZE_EXIST) != 0) && (Reply->WindowSize > Request->WindowSize))) {
     return FALSE;
   }
 
@@ -614,6 +639,10 @@ Mtftp4RrqHandleOack (
     if (Reply.Timeout != 0) {
       Instance->Timeout = Reply.Timeout;
     }
+
+    if (Reply.WindowSize != 0) {
+      Instance->WindowSize = Reply.WindowSize;
+    }
   }
   
   //
@@ -693,19 +722,11 @@ Mtftp4RrqInput (
   //
   Len = UdpPacket->TotalSize;
 
-  if (UdpPacket->BlockOpNum > 1) {
-    Packet = AllocatePool (Len);
-
-    if (Packet == NULL) {
-      Status = EFI_OUT_OF_RESOURCES;
-      goto ON_EXIT;
-    }
-
-    NetbufCopy (UdpPacket, 0, Len, (UINT8 *) Packet);
+  Packet = Mtftp4GetPacket (Instance, UdpPacket);
 
-  } else {
-    Packet = (EFI_MTFTP4_PACKET *) NetbufGetByte (UdpPacket, 0, NULL);
-    ASSERT (Packet != NULL);
+  if (Packet == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto ON_EXIT;
   }
 
   Opcode = NTOHS (Packet->OpCode);
@@ -773,10 +794,6 @@ ON_EXIT:
   // Free the resources, then if !EFI_ERROR (Status), restart the
   // receive, otherwise end the session.
   //
-  if ((Packet != NULL) && (UdpPacket->BlockOpNum > 1)) {
-    FreePool (Packet);
-  }
-
   if (UdpPacket != NULL) {
     NetbufFree (UdpPacket);
   }
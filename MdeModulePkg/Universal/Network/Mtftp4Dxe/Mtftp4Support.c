@@ -495,6 +495,51 @@ Mtftp4SendPacket (
 }
 
 
+/**
+  Get a continuous view of a received MTFTP packet.
+
+  If the packet is already in one block, it is accessed in place. Otherwise,
+  such as for a data block reassembled from IP fragments, it is copied into
+  the receive buffer of the instance, which is reused by later packets.
+
+  @param  Instance              The Mtftp instance
+  @param  UdpPacket             The received packet
+
+  @return Pointer to the continuous packet, NULL if failed to allocate memory.
+
+**/
+EFI_MTFTP4_PACKET *
+Mtftp4GetPacket (
+  IN MTFTP4_PROTOCOL        *Instance,
+  IN NET_BUF                *UdpPacket
+  )
+{
+  UINT8                     *Buffer;
+
+  if (UdpPacket->BlockOpNum <= 1) {
+    return (EFI_MTFTP4_PACKET *) NetbufGetByte (UdpPacket, 0, NULL);
+  }
+
+  if (Instance->RcvBufferSize < UdpPacket->TotalSize) {
+    Buffer = AllocatePool (UdpPacket->TotalSize);
+
+    if (Buffer == NULL) {
+      return NULL;
+    }
+
+    if (Instance->RcvBuffer != NULL) {
+      FreePool (Instance->RcvBuffer);
+    }
+
+    Instance->RcvBuffer     = Buffer;
+    Instance->RcvBufferSize = UdpPacket->TotalSize;
+  }
+
+  NetbufCopy (UdpPacket, 0, UdpPacket->TotalSize, Instance->RcvBuffer);
+  return (EFI_MTFTP4_PACKET *) Instance->RcvBuffer;
+}
+
+
 /**
   Retransmit the last packet for the instance.
 
@@ -173,6 +173,25 @@ Mtftp4SendError (
   IN UINT8                  *ErrInfo
   );
 
+/**
+  Get a continuous view of a received MTFTP packet.
+
+  If the packet is already in one block, it is accessed in place. Otherwise,
+  such as for a data block reassembled from IP fragments, it is copied into
+  the receive buffer of the instance, which is reused by later packets.
+
+  @param  Instance              The Mtftp instance
+  @param  UdpPacket             The received packet
+
+  @return Pointer to the continuous packet, NULL if failed to allocate memory.
+
+**/
+EFI_MTFTP4_PACKET *
+Mtftp4GetPacket (
+  IN MTFTP4_PROTOCOL        *Instance,
+  IN NET_BUF                *UdpPacket
+  );
+
 /**
   Retransmit the last packet for the instance.
 
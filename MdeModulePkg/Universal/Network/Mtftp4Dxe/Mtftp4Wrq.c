@@ -235,6 +235,13 @@ Mtftp4WrqOackValid (
     return FALSE;
   }
 
+  //
+  // Uploads don't support a transfer window.
+  //
+  if ((Reply->Exist & MTFTP4_WINDOWSIZE_EXIST) != 0) {
+    return FALSE;
+  }
+
   return TRUE;
 }
 
@@ -386,19 +393,11 @@ Mtftp4WrqInput (
   //
   Len = UdpPacket->TotalSize;
 
-  if (UdpPacket->BlockOpNum > 1) {
-    Packet = AllocatePool (Len);
+  Packet = Mtftp4GetPacket (Instance, UdpPacket);
 
-    if (Packet == NULL) {
-      Status = EFI_OUT_OF_RESOURCES;
-      goto ON_EXIT;
-    }
-
-    NetbufCopy (UdpPacket, 0, Len, (UINT8 *) Packet);
-
-  } else {
-    Packet = (EFI_MTFTP4_PACKET *) NetbufGetByte (UdpPacket, 0, NULL);
-    ASSERT (Packet != NULL);
+  if (Packet == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto ON_EXIT;
   }
 
   Opcode = NTOHS (Packet->OpCode);
@@ -464,10 +463,6 @@ ON_EXIT:
   // Free the resources, then if !EFI_ERROR (Status) and not completed,
   // restart the receive, otherwise end the session.
   //
-  if ((Packet != NULL) && (UdpPacket->BlockOpNum > 1)) {
-    FreePool (Packet);
-  }
-
   if (UdpPacket != NULL) {
     NetbufFree (UdpPacket);
   }
@@ -192,11 +192,13 @@ Udp4EnqueueDgram (
   This function delivers the datagrams enqueued in the instances.
 
   @param[in]  Udp4Service            Pointer to the udp service context data.
+  @param[in]  DestinationPort        The destination port of the enqueued datagram.
 
 **/
 VOID
 Udp4DeliverDgram (
-  IN UDP4_SERVICE_DATA  *Udp4Service
+  IN UDP4_SERVICE_DATA  *Udp4Service,
+  IN UINT16             DestinationPort
   );
 
 /**
@@ -276,6 +278,7 @@ Udp4CreateService (
   EFI_STATUS          Status;
   IP_IO_OPEN_DATA     OpenData;
   EFI_IP4_CONFIG_DATA *Ip4ConfigData;
+  UINTN               Index;
 
   ZeroMem (Udp4Service, sizeof (UDP4_SERVICE_DATA));
 
@@ -287,6 +290,11 @@ Udp4CreateService (
 
   InitializeListHead (&Udp4Service->ChildrenList);
 
+  for (Index = 0; Index < UDP4_PORT_HASH_SIZE; Index++) {
+    InitializeListHead (&Udp4Service->PortHash[Index]);
+  }
+  InitializeListHead (&Udp4Service->AnyPortList);
+
   //
   // Create the IpIo for this service context.
   //
@@ -466,6 +474,7 @@ Udp4InitInstance (
   // Init the lists.
   //
   InitializeListHead (&Instance->Link);
+  InitializeListHead (&Instance->DemuxLink);
   InitializeListHead (&Instance->RcvdDgramQue);
   InitializeListHead (&Instance->DeliveredDgramQue);
 
@@ -488,6 +497,30 @@ Udp4InitInstance (
 }
 
 
+/**
+  This function returns the list of the service's configured instances that the
+  instance with ConfigData belongs to.
+
+  @param[in]  Udp4Service        Pointer to the udp service context data.
+  @param[in]  ConfigData         Pointer to the configuration data of the instance.
+
+  @return Pointer to the head of the demultiplexing list.
+
+**/
+LIST_ENTRY *
+Udp4DemuxList (
+  IN UDP4_SERVICE_DATA     *Udp4Service,
+  IN EFI_UDP4_CONFIG_DATA  *ConfigData
+  )
+{
+  if (ConfigData->AcceptAnyPort || ConfigData->AcceptPromiscuous) {
+    return &Udp4Service->AnyPortList;
+  }
+
+  return &Udp4Service->PortHash[UDP4_PORT_HASH (ConfigData->StationPort)];
+}
+
+
 /**
   This function cleans the udp instance.
 
@@ -1451,37 +1484,45 @@ Udp4EnqueueDgram (
   IN EFI_UDP4_RECEIVE_DATA  *RxData
   )
 {
+  LIST_ENTRY          *Lists[2];
   LIST_ENTRY          *Entry;
   UDP4_INSTANCE_DATA  *Instance;
   UDP4_RXDATA_WRAP    *Wrap;
   UINTN               Enqueued;
+  UINTN               Index;
 
   Enqueued = 0;
 
-  NET_LIST_FOR_EACH (Entry, &Udp4Service->ChildrenList) {
-    //
-    // Iterate the instances.
-    //
-    Instance = NET_LIST_USER_STRUCT (Entry, UDP4_INSTANCE_DATA, Link);
-
-    if (!Instance->Configured) {
-      continue;
-    }
+  //
+  // Only the instances bound to the destination port, or accepting any port,
+  // can match.
+  //
+  Lists[0] = &Udp4Service->PortHash[UDP4_PORT_HASH (RxData->UdpSession.DestinationPort)];
+  Lists[1] = &Udp4Service->AnyPortList;
 
-    if (Udp4MatchDgram (Instance, &RxData->UdpSession)) {
+  for (Index = 0; Index < 2; Index++) {
+    NET_LIST_FOR_EACH (Entry, Lists[Index]) {
       //
-      // Wrap the RxData and put this Wrap into the instances RcvdDgramQue.
+      // Iterate the instances.
       //
-      Wrap = Udp4WrapRxData (Instance, Packet, RxData);
-      if (Wrap == NULL) {
-        continue;
-      }
+      Instance = NET_LIST_USER_STRUCT (Entry, UDP4_INSTANCE_DATA, DemuxLink);
+      ASSERT (Instance->Configured);
+
+      if (Udp4MatchDgram (Instance, &RxData->UdpSession)) {
+        //
+        // Wrap the RxData and put this Wrap into the instances RcvdDgramQue.
+        //
+        Wrap = Udp4WrapRxData (Instance, Packet, RxData);
+        if (Wrap == NULL) {
+          continue;
+        }
 
-      NET_GET_REF (Packet);
+        NET_GET_REF (Packet);
 
-      InsertTailList (&Instance->RcvdDgramQue, &Wrap->Link);
+        InsertTailList (&Instance->RcvdDgramQue, &Wrap->Link);
 
-      Enqueued++;
+        Enqueued++;
+      }
     }
   }
 
@@ -1557,30 +1598,39 @@ Udp4InstanceDeliverDgram (
   This function delivers the datagrams enqueued in the instances.
 
   @param[in]  Udp4Service            Pointer to the udp service context data.
+  @param[in]  DestinationPort        The destination port of the enqueued datagram.
 
 **/
 VOID
 Udp4DeliverDgram (
-  IN UDP4_SERVICE_DATA  *Udp4Service
+  IN UDP4_SERVICE_DATA  *Udp4Service,
+  IN UINT16             DestinationPort
   )
 {
+  LIST_ENTRY          *Lists[2];
   LIST_ENTRY          *Entry;
+  LIST_ENTRY          *Next;
   UDP4_INSTANCE_DATA  *Instance;
+  UINTN               Index;
 
-  NET_LIST_FOR_EACH (Entry, &Udp4Service->ChildrenList) {
-    //
-    // Iterate the instances.
-    //
-    Instance = NET_LIST_USER_STRUCT (Entry, UDP4_INSTANCE_DATA, Link);
+  //
+  // The datagram can only have been enqueued to the instances in these lists.
+  //
+  Lists[0] = &Udp4Service->PortHash[UDP4_PORT_HASH (DestinationPort)];
+  Lists[1] = &Udp4Service->AnyPortList;
 
-    if (!Instance->Configured) {
-      continue;
-    }
+  for (Index = 0; Index < 2; Index++) {
+    NET_LIST_FOR_EACH_SAFE (Entry, Next, Lists[Index]) {
+      //
+      // Iterate the instances.
+      //
+      Instance = NET_LIST_USER_STRUCT (Entry, UDP4_INSTANCE_DATA, DemuxLink);
 
-    //
-    // Deliver the datagrams of this instance.
-    //
-    Udp4InstanceDeliverDgram (Instance);
+      //
+      // Deliver the datagrams of this instance.
+      //
+      Udp4InstanceDeliverDgram (Instance);
+    }
   }
 }
 
@@ -1668,7 +1718,7 @@ Udp4Demultiplex (
     //
     // Deliver the datagram.
     //
-    Udp4DeliverDgram (Udp4Service);
+    Udp4DeliverDgram (Udp4Service, RxData.UdpSession.DestinationPort);
   }
 }
 
@@ -52,6 +52,12 @@ extern UINT16                          mUdp4RandomPort;
 
 #define UDP4_PORT_KNOWN       1024
 
+//
+// Configured instances are hashed by their station port for demultiplexing.
+//
+#define UDP4_PORT_HASH_SIZE   32
+#define UDP4_PORT_HASH(Port)  ((Port) & (UDP4_PORT_HASH_SIZE - 1))
+
 #define UDP4_SERVICE_DATA_SIGNATURE  SIGNATURE_32('U', 'd', 'p', '4')
 
 #define UDP4_SERVICE_DATA_FROM_THIS(a) \
@@ -71,6 +77,13 @@ typedef struct _UDP4_SERVICE_DATA_ {
   UINTN                         ChildrenNumber;
   IP_IO                         *IpIo;
 
+  //
+  // Configured instances, by station port; those accepting any port or in
+  // the promiscuous state are kept in AnyPortList.
+  //
+  LIST_ENTRY                    PortHash[UDP4_PORT_HASH_SIZE];
+  LIST_ENTRY                    AnyPortList;
+
   EFI_EVENT                     TimeoutEvent;
 } UDP4_SERVICE_DATA;
 
@@ -87,6 +100,7 @@ typedef struct _UDP4_SERVICE_DATA_ {
 typedef struct _UDP4_INSTANCE_DATA_ {
   UINT32                Signature;
   LIST_ENTRY            Link;
+  LIST_ENTRY            DemuxLink;
 
   UDP4_SERVICE_DATA     *Udp4Service;
   EFI_UDP4_PROTOCOL     Udp4Proto;
@@ -458,6 +472,22 @@ Udp4InitInstance (
   IN OUT UDP4_INSTANCE_DATA  *Instance
   );
 
+/**
+  This function returns the list of the service's configured instances that the
+  instance with ConfigData belongs to.
+
+  @param[in]  Udp4Service        Pointer to the udp service context data.
+  @param[in]  ConfigData         Pointer to the configuration data of the instance.
+
+  @return Pointer to the head of the demultiplexing list.
+
+**/
+LIST_ENTRY *
+Udp4DemuxList (
+  IN UDP4_SERVICE_DATA     *Udp4Service,
+  IN EFI_UDP4_CONFIG_DATA  *ConfigData
+  );
+
 /**
   This function cleans the udp instance.
 
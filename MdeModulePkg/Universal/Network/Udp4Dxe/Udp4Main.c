@@ -256,6 +256,14 @@ Udp4Configure (
                             );
 
       Instance->Configured = TRUE;
+
+      //
+      // Add the instance to the list used to demultiplex the received datagrams.
+      //
+      InsertTailList (
+        Udp4DemuxList (Udp4Service, &Instance->ConfigData),
+        &Instance->DemuxLink
+        );
     }
   } else {
     //
@@ -264,6 +272,9 @@ Udp4Configure (
     Instance->Configured  = FALSE;
     Instance->IsNoMapping = FALSE;
 
+    RemoveEntryList (&Instance->DemuxLink);
+    InitializeListHead (&Instance->DemuxLink);
+
     //
     // Reset the Ip instance wrapped in the IpInfo.
     //
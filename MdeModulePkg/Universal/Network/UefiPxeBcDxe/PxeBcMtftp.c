@@ -18,7 +18,8 @@ CHAR8 *mMtftpOptions[PXE_MTFTP_OPTION_MAXIMUM_INDEX] = {
   "blksize",
   "timeout",
   "tsize",
-  "multicast"
+  "multicast",
+  "windowsize"
 };
 
 
@@ -241,14 +242,16 @@ PxeBcTftpReadFile (
 {
   EFI_MTFTP4_PROTOCOL *Mtftp4;
   EFI_MTFTP4_TOKEN    Token;
-  EFI_MTFTP4_OPTION   ReqOpt[1];
+  EFI_MTFTP4_OPTION   ReqOpt[2];
   UINT32              OptCnt;
   UINT8               OptBuf[128];
+  UINT8               *OptValue;
   EFI_STATUS          Status;
 
   Status                    = EFI_DEVICE_ERROR;
   Mtftp4                    = Private->Mtftp4;
   OptCnt                    = 0;
+  OptValue                  = OptBuf;
   Config->InitialServerPort = PXEBC_BS_DOWNLOAD_PORT;
 
   Status = Mtftp4->Configure (Mtftp4, Config);
@@ -259,9 +262,21 @@ PxeBcTftpReadFile (
 
   if (BlockSize != NULL) {
 
-    ReqOpt[0].OptionStr = (UINT8*) mMtftpOptions[PXE_MTFTP_OPTION_BLKSIZE_INDEX];
-    ReqOpt[0].ValueStr  = OptBuf;
-    UtoA10 (*BlockSize, (CHAR8 *) ReqOpt[0].ValueStr);
+    ReqOpt[OptCnt].OptionStr = (UINT8*) mMtftpOptions[PXE_MTFTP_OPTION_BLKSIZE_INDEX];
+    ReqOpt[OptCnt].ValueStr  = OptValue;
+    UtoA10 (*BlockSize, (CHAR8 *) ReqOpt[OptCnt].ValueStr);
+    OptValue += AsciiStrLen ((CHAR8 *) OptValue) + 1;
+    OptCnt++;
+  }
+
+  //
+  // Ask the server to send several blocks per ACK if PcdTftpWindowSize is set.
+  //
+  if (PcdGet64 (PcdTftpWindowSize) != 0) {
+
+    ReqOpt[OptCnt].OptionStr = (UINT8*) mMtftpOptions[PXE_MTFTP_OPTION_WINDOWSIZE_INDEX];
+    ReqOpt[OptCnt].ValueStr  = OptValue;
+    UtoA10 ((UINTN) PcdGet64 (PcdTftpWindowSize), (CHAR8 *) ReqOpt[OptCnt].ValueStr);
     OptCnt++;
   }
 
@@ -19,7 +19,8 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 #define PXE_MTFTP_OPTION_TIMEOUT_INDEX   1
 #define PXE_MTFTP_OPTION_TSIZE_INDEX     2
 #define PXE_MTFTP_OPTION_MULTICAST_INDEX 3
-#define PXE_MTFTP_OPTION_MAXIMUM_INDEX   4
+#define PXE_MTFTP_OPTION_WINDOWSIZE_INDEX 4
+#define PXE_MTFTP_OPTION_MAXIMUM_INDEX   5
 
 #define PXE_MTFTP_ERROR_STRING_LENGTH    127
 
@@ -825,6 +825,7 @@ IdToQuestion2 (
 {
   LIST_ENTRY              *Link;
   FORM_BROWSER_STATEMENT  *Question;
+  UINTN                   Index;
 
   if (QuestionId == 0 || Form == NULL) {
     //
@@ -833,11 +834,22 @@ IdToQuestion2 (
     return NULL;
   }
 
+  //
+  // Expressions look up the same questions on every form refresh, check the
+  // lookup cache before walking the statement list.
+  //
+  Index    = FORM_QUESTION_CACHE_INDEX (QuestionId);
+  Question = Form->QuestionCache[Index];
+  if (Question != NULL && Question->QuestionId == QuestionId) {
+    return Question;
+  }
+
   Link = GetFirstNode (&Form->StatementListHead);
   while (!IsNull (&Form->StatementListHead, Link)) {
     Question = FORM_BROWSER_STATEMENT_FROM_LINK (Link);
 
     if (Question->QuestionId == QuestionId) {
+      Form->QuestionCache[Index] = Question;
       return Question;
     }
 
@@ -393,6 +393,12 @@ typedef struct {
 #define FORM_BROWSER_FORM_SIGNATURE  SIGNATURE_32 ('F', 'F', 'R', 'M')
 #define STANDARD_MAP_FORM_TYPE 0x01
 
+//
+// Number of slots in the per form QuestionId lookup cache, must be a power of 2.
+//
+#define FORM_QUESTION_CACHE_SIZE  64
+#define FORM_QUESTION_CACHE_INDEX(QuestionId)  ((QuestionId) & (FORM_QUESTION_CACHE_SIZE - 1))
+
 typedef struct {
   UINTN                Signature;
   LIST_ENTRY           Link;
@@ -411,6 +417,13 @@ typedef struct {
   LIST_ENTRY           StatementListHead;    // List of Statements and Questions (FORM_BROWSER_STATEMENT)
   LIST_ENTRY           ConfigRequestHead;    // List of configreques for all storage.
   FORM_EXPRESSION_LIST *SuppressExpression;  // nesting inside of SuppressIf
+
+  //
+  // Questions found by IdToQuestion2(), indexed by FORM_QUESTION_CACHE_INDEX (QuestionId).
+  // Statements are only added while the form is parsed and only freed together with
+  // the form, so an entry stays valid for the lifetime of the form.
+  //
+  FORM_BROWSER_STATEMENT *QuestionCache[FORM_QUESTION_CACHE_SIZE];
 } FORM_BROWSER_FORM;
 
 #define FORM_BROWSER_FORM_FROM_LINK(a)  CR (a, FORM_BROWSER_FORM, Link, FORM_BROWSER_FORM_SIGNATURE)
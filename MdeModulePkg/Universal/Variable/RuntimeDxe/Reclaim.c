@@ -99,6 +99,12 @@ GetLbaAndOffsetByAddress (
   volume block device. The destination is specified by parameter
   VariableBase. Fault Tolerant Write protocol is used for writing.
 
+  Leading and trailing flash blocks whose content already matches the buffer
+  are left untouched, so the FTW record only covers the blocks that actually
+  change.  Reclaim keeps variables ahead of the first deleted one in place and
+  the free space at the end stays erased, which typically leaves both ends of
+  the store unchanged.
+
   @param  VariableBase   Base address of variable to write
   @param  VariableBuffer Point to the variable data buffer.
 
@@ -119,6 +125,13 @@ FtwVariableSpace (
   UINTN                              VarOffset;
   UINTN                              FtwBufferSize;
   EFI_FAULT_TOLERANT_WRITE_PROTOCOL  *FtwProtocol;
+  EFI_FIRMWARE_VOLUME_BLOCK_PROTOCOL *Fvb;
+  UINTN                              BlockSize;
+  UINTN                              NumberOfBlocks;
+  UINTN                              WriteStart;
+  UINTN                              WriteEnd;
+  UINTN                              ChunkStart;
+  UINTN                              ChunkSize;
 
   //
   // Locate fault tolerant write protocol.
@@ -130,7 +143,7 @@ FtwVariableSpace (
   //
   // Locate Fvb handle by address.
   //
-  Status = GetFvbInfoByAddress (VariableBase, &FvbHandle, NULL);
+  Status = GetFvbInfoByAddress (VariableBase, &FvbHandle, &Fvb);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -145,17 +158,63 @@ FtwVariableSpace (
   FtwBufferSize = ((VARIABLE_STORE_HEADER *) ((UINTN) VariableBase))->Size;
   ASSERT (FtwBufferSize == VariableBuffer->Size);
 
+  WriteStart = 0;
+  WriteEnd   = FtwBufferSize;
+
+  Status = Fvb->GetBlockSize (Fvb, VarLba, &BlockSize, &NumberOfBlocks);
+  if (!EFI_ERROR (Status) && BlockSize > VarOffset) {
+    //
+    // Skip the leading blocks that are unchanged. The first chunk ends at the
+    // end of the block holding the store header.
+    //
+    ChunkSize = BlockSize - VarOffset;
+    while (WriteStart < WriteEnd) {
+      ChunkSize = MIN (ChunkSize, WriteEnd - WriteStart);
+      if (CompareMem ((UINT8 *) (UINTN) VariableBase + WriteStart, (UINT8 *) VariableBuffer + WriteStart, ChunkSize) != 0) {
+        break;
+      }
+      WriteStart += ChunkSize;
+      ChunkSize   = BlockSize;
+    }
+
+    if (WriteStart == WriteEnd) {
+      //
+      // The store already holds the reclaimed content.
+      //
+      return EFI_SUCCESS;
+    }
+
+    //
+    // Skip the trailing blocks that are unchanged.
+    //
+    while (WriteEnd > WriteStart) {
+      ChunkStart = ((WriteEnd + VarOffset - 1) / BlockSize) * BlockSize;
+      ChunkStart = (ChunkStart > VarOffset + WriteStart) ? ChunkStart - VarOffset : WriteStart;
+      if (CompareMem ((UINT8 *) (UINTN) VariableBase + ChunkStart, (UINT8 *) VariableBuffer + ChunkStart, WriteEnd - ChunkStart) != 0) {
+        break;
+      }
+      WriteEnd = ChunkStart;
+    }
+
+    if (WriteStart != 0) {
+      Status = GetLbaAndOffsetByAddress (VariableBase + WriteStart, &VarLba, &VarOffset);
+      if (EFI_ERROR (Status)) {
+        return EFI_ABORTED;
+      }
+    }
+  }
+
   //
   // FTW write record.
   //
   Status = FtwProtocol->Write (
                           FtwProtocol,
-                          VarLba,         // LBA
-                          VarOffset,      // Offset
-                          FtwBufferSize,  // NumBytes
-                          NULL,           // PrivateData NULL
-                          FvbHandle,      // Fvb Handle
-                          (VOID *) VariableBuffer // write buffer
+                          VarLba,                   // LBA
+                          VarOffset,                // Offset
+                          WriteEnd - WriteStart,    // NumBytes
+                          NULL,                     // PrivateData NULL
+                          FvbHandle,                // Fvb Handle
+                          (UINT8 *) VariableBuffer + WriteStart // write buffer
                           );
 
   return Status;
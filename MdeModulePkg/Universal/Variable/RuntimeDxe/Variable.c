@@ -34,6 +34,13 @@ VARIABLE_MODULE_GLOBAL  *mVariableModuleGlobal;
 ///
 VARIABLE_STORE_HEADER  *mNvVariableCache      = NULL;
 
+///
+/// Cache of recent FindVariable() results, only valid while the variable stores
+/// are unchanged. mVariableStoreGeneration is advanced on every store update.
+///
+VARIABLE_LOOKUP_CACHE_ENTRY  mVariableLookupCache[VARIABLE_LOOKUP_CACHE_SIZE];
+UINT32                       mVariableStoreGeneration = 1;
+
 ///
 /// The memory entry used for variable statistics data.
 ///
@@ -152,6 +159,28 @@ UpdateVariableInfo (
 }
 
 
+/**
+  Invalidate every entry of the variable lookup cache.
+
+  Must be called whenever the content or the layout of a variable store changes.
+
+**/
+VOID
+InvalidateVariableLookupCache (
+  VOID
+  )
+{
+  mVariableStoreGeneration++;
+  if (mVariableStoreGeneration == 0) {
+    //
+    // Entries that were never used hold generation 0, skip it on wrap around.
+    //
+    ZeroMem (mVariableLookupCache, sizeof (mVariableLookupCache));
+    mVariableStoreGeneration = 1;
+  }
+}
+
+
 /**
 
   This code checks if variable header is valid or not.
@@ -228,6 +257,8 @@ UpdateVariableStore (
   FwVolHeader = NULL;
   DataPtr     = DataPtrIndex;
 
+  InvalidateVariableLookupCache ();
+
   //
   // Check if the Data is Volatile.
   //
@@ -573,6 +604,7 @@ Reclaim (
 
   UpdatingVariable = NULL;
   UpdatingInDeletedTransition = NULL;
+  InvalidateVariableLookupCache ();
   if (UpdatingPtrTrack != NULL) {
     UpdatingVariable = UpdatingPtrTrack->CurrPtr;
     UpdatingInDeletedTransition = UpdatingPtrTrack->InDeletedTransitionPtr;
@@ -786,6 +818,7 @@ Done:
     //
     CopyMem (mNvVariableCache, (UINT8 *)(UINTN)VariableBase, VariableStoreHeader->Size);
   }
+  InvalidateVariableLookupCache ();
 
   return Status;
 }
@@ -859,6 +892,31 @@ FindVariableEx (
 }
 
 
+/**
+  Compute the variable lookup cache slot for a variable name and vendor GUID.
+
+  @param  VariableName        Name of the variable, not empty.
+  @param  VendorGuid          Vendor GUID of the variable.
+
+  @return Index in mVariableLookupCache.
+
+**/
+UINTN
+GetVariableLookupCacheIndex (
+  IN  CHAR16                  *VariableName,
+  IN  EFI_GUID                *VendorGuid
+  )
+{
+  UINT32                      Hash;
+
+  Hash = ReadUnaligned32 ((UINT32 *) VendorGuid);
+  while (*VariableName != 0) {
+    Hash = Hash * 31 + *VariableName;
+    VariableName++;
+  }
+  return (UINTN) ((Hash ^ (Hash >> 16)) & (VARIABLE_LOOKUP_CACHE_SIZE - 1));
+}
+
 /**
   Finds variable in storage blocks of volatile and non-volatile storage areas.
 
@@ -894,9 +952,11 @@ FindVariable (
   IN  BOOLEAN                 IgnoreRtCheck
   )
 {
-  EFI_STATUS              Status;
-  VARIABLE_STORE_HEADER   *VariableStoreHeader[VariableStoreTypeMax];
-  VARIABLE_STORE_TYPE     Type;
+  EFI_STATUS                  Status;
+  VARIABLE_STORE_HEADER       *VariableStoreHeader[VariableStoreTypeMax];
+  VARIABLE_STORE_TYPE         Type;
+  VARIABLE_LOOKUP_CACHE_ENTRY *CacheEntry;
+  VARIABLE_HEADER             *Variable;
 
   if (VariableName[0] != 0 && VendorGuid == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -911,6 +971,31 @@ FindVariable (
   VariableStoreHeader[VariableStoreTypeHob]      = (VARIABLE_STORE_HEADER *) (UINTN) Global->HobVariableBase;
   VariableStoreHeader[VariableStoreTypeNv]       = mNvVariableCache;
 
+  //
+  // BDS and the OS look up the same variables over and over. Try the location
+  // saved by an earlier search while the stores have not been changed since.
+  // A cached variable is only a valid answer if it is still added, and
+  // when the runtime access check applies, if it passes that check.
+  //
+  CacheEntry = NULL;
+  if (VariableName[0] != 0) {
+    CacheEntry = &mVariableLookupCache[GetVariableLookupCacheIndex (VariableName, VendorGuid)];
+    if (CacheEntry->Generation == mVariableStoreGeneration && VariableStoreHeader[CacheEntry->Type] != NULL) {
+      Variable = (VARIABLE_HEADER *) ((UINTN) VariableStoreHeader[CacheEntry->Type] + CacheEntry->Offset);
+      if (Variable->State == VAR_ADDED &&
+          (IgnoreRtCheck || !AtRuntime () || ((Variable->Attributes & EFI_VARIABLE_RUNTIME_ACCESS) != 0)) &&
+          CompareGuid (VendorGuid, &Variable->VendorGuid) &&
+          CompareMem (VariableName, GetVariableNamePtr (Variable), NameSizeOfVariable (Variable)) == 0) {
+        PtrTrack->StartPtr               = GetStartPointer (VariableStoreHeader[CacheEntry->Type]);
+        PtrTrack->EndPtr                 = GetEndPointer   (VariableStoreHeader[CacheEntry->Type]);
+        PtrTrack->Volatile               = (BOOLEAN) (CacheEntry->Type == VariableStoreTypeVolatile);
+        PtrTrack->CurrPtr                = Variable;
+        PtrTrack->InDeletedTransitionPtr = NULL;
+        return EFI_SUCCESS;
+      }
+    }
+  }
+
   //
   // Find the variable by walk through HOB, volatile and non-volatile variable store.
   //
@@ -925,6 +1010,16 @@ FindVariable (
 
     Status = FindVariableEx (VariableName, VendorGuid, IgnoreRtCheck, PtrTrack);
     if (!EFI_ERROR (Status)) {
+      //
+      // Only save results that do not depend on the runtime access check, so
+      // that a cached entry is always the first match in store order.
+      //
+      if (CacheEntry != NULL && (IgnoreRtCheck || !AtRuntime ()) &&
+          PtrTrack->InDeletedTransitionPtr == NULL && PtrTrack->CurrPtr->State == VAR_ADDED) {
+        CacheEntry->Generation = mVariableStoreGeneration;
+        CacheEntry->Type       = Type;
+        CacheEntry->Offset     = (UINTN) PtrTrack->CurrPtr - (UINTN) VariableStoreHeader[Type];
+      }
       return Status;
     }
   }
@@ -2069,6 +2164,11 @@ UpdateVariable (
   }
 
 Done:
+  //
+  // The memory copy of the NV store is updated directly above, drop any
+  // location saved while the update was in progress.
+  //
+  InvalidateVariableLookupCache ();
   return Status;
 }
 
@@ -3039,6 +3139,7 @@ FlushHobVariableToFlash (
     // Set HobVariableBase to 0, it can avoid SetVariable to call back.
     //
     mVariableModuleGlobal->VariableGlobal.HobVariableBase = 0;
+    InvalidateVariableLookupCache ();
     for ( Variable = GetStartPointer (VariableStoreHeader)
         ; IsValidVariableHeader (Variable, GetEndPointer (VariableStoreHeader))
         ; Variable = GetNextVariablePtr (Variable)
@@ -3086,6 +3187,7 @@ FlushHobVariableToFlash (
       // We still have HOB variable(s) not flushed in flash.
       //
       mVariableModuleGlobal->VariableGlobal.HobVariableBase = (EFI_PHYSICAL_ADDRESS) (UINTN) VariableStoreHeader;
+      InvalidateVariableLookupCache ();
     } else {
       //
       // All HOB variables have been flushed in flash.
@@ -73,6 +73,21 @@ typedef struct {
   BOOLEAN         Volatile;
 } VARIABLE_POINTER_TRACK;
 
+///
+/// Number of entries in the variable lookup cache, must be a power of 2.
+///
+#define VARIABLE_LOOKUP_CACHE_SIZE  64
+
+///
+/// Location of a variable found by FindVariable(). The location is kept as an
+/// offset into its store so the entry needs no conversion at SetVirtualAddressMap.
+///
+typedef struct {
+  UINT32                Generation;   // mVariableStoreGeneration when the entry was saved
+  VARIABLE_STORE_TYPE   Type;         // store holding the variable
+  UINTN                 Offset;       // offset of the variable header from the store header
+} VARIABLE_LOOKUP_CACHE_ENTRY;
+
 typedef struct {
   EFI_PHYSICAL_ADDRESS  HobVariableBase;
   EFI_PHYSICAL_ADDRESS  VolatileVariableBase;
@@ -106,6 +121,17 @@ typedef struct {
   //CHAR16      *Name;
 } VARIABLE_ENTRY;
 
+/**
+  Invalidate every entry of the variable lookup cache.
+
+  Must be called whenever the content or the layout of a variable store changes.
+
+**/
+VOID
+InvalidateVariableLookupCache (
+  VOID
+  );
+
 /**
   Flush the HOB variable to flash.
 
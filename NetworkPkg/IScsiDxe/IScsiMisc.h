@@ -174,6 +174,27 @@ IScsiNetNtoi (
   IN     CHAR8  *Str
   );
 
+/**
+  Calculate the CRC32C (Castagnoli) checksum used by the iSCSI header and data
+  digests, eight bytes at a time.
+
+  The calculation can be split over several calls by passing the result of the
+  previous call as Crc.
+
+  @param[in]  Crc        The CRC32C of the preceding data, or 0 to start.
+  @param[in]  Data       The data to checksum.
+  @param[in]  Len        Length of the data in bytes.
+
+  @return The CRC32C of the preceding data and Data.
+
+**/
+UINT32
+IScsiCrc32c (
+  IN UINT32       Crc,
+  IN CONST UINT8  *Data,
+  IN UINTN        Len
+  );
+
 /**
   Generate random numbers.
 
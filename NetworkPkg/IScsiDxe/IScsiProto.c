@@ -245,11 +245,13 @@ IScsiCreateConnection (
   NetbufQueInit (&Conn->RspQue);
 
   //
-  // Set the default connection-only parameters.
+  // Set the default connection-only parameters. Digests are offered as
+  // "None,CRC32C": targets that allow it keep them off, targets that require
+  // them can select CRC32C.
   //
   Conn->MaxRecvDataSegmentLength  = DEFAULT_MAX_RECV_DATA_SEG_LEN;
-  Conn->HeaderDigest              = IScsiDigestNone;
-  Conn->DataDigest                = IScsiDigestNone;
+  Conn->HeaderDigest              = IScsiDigestCRC32;
+  Conn->DataDigest                = IScsiDigestCRC32;
 
   if (!Conn->Ipv6Flag) {
     Tcp4IoConfig = &TcpIoConfig.Tcp4IoConfigData;
@@ -1185,6 +1187,159 @@ IScsiNbufExtFree (
 }
 
 
+/**
+  Calculate the CRC32C of the leading bytes of a net buffer.
+
+  @param[in]  Nbuf       The net buffer.
+  @param[in]  Len        The number of leading bytes to checksum.
+
+  @return The CRC32C of the first Len bytes of Nbuf.
+
+**/
+STATIC
+UINT32
+IScsiNetbufCrc32c (
+  IN NET_BUF  *Nbuf,
+  IN UINT32   Len
+  )
+{
+  UINT32  Index;
+  UINT32  Crc;
+  UINT32  Chunk;
+
+  Crc = 0;
+  for (Index = 0; (Index < Nbuf->BlockOpNum) && (Len > 0); Index++) {
+    Chunk = MIN (Nbuf->BlockOp[Index].Size, Len);
+    Crc   = IScsiCrc32c (Crc, Nbuf->BlockOp[Index].Head, Chunk);
+    Len  -= Chunk;
+  }
+
+  return Crc;
+}
+
+
+/**
+  Send an iSCSI PDU in the full feature phase, appending the header digest and
+  the data digest negotiated on the connection, if any.
+
+  @param[in]  Conn             The iSCSI connection to send the PDU on.
+  @param[in]  Pdu              The iSCSI PDU, with its data segment padded.
+
+  @retval EFI_SUCCESS          The PDU is sent.
+  @retval EFI_OUT_OF_RESOURCES Failed to allocate memory.
+  @retval Others               Other errors as indicated.
+
+**/
+EFI_STATUS
+IScsiSendPdu (
+  IN ISCSI_CONNECTION  *Conn,
+  IN NET_BUF           *Pdu
+  )
+{
+  NET_FRAGMENT  *Fragment;
+  UINT32        FragmentCount;
+  UINT8         *Header;
+  UINT32        HeaderLen;
+  UINT32        Offset;
+  UINT32        Index;
+  UINT8         *Bulk;
+  UINT32        Len;
+  UINT32        Chunk;
+  UINT32        Crc;
+  UINT32        Digest[2];
+  BOOLEAN       HeaderDigest;
+  BOOLEAN       DataDigest;
+  NET_BUF       *DigestPdu;
+  EFI_STATUS    Status;
+
+  HeaderDigest = (BOOLEAN) (Conn->HeaderDigest == IScsiDigestCRC32);
+  DataDigest   = (BOOLEAN) (Conn->DataDigest == IScsiDigestCRC32);
+  if (!HeaderDigest && !DataDigest) {
+    return TcpIoTransmit (&Conn->TcpIo, Pdu);
+  }
+
+  Header = NetbufGetByte (Pdu, 0, NULL);
+  if (Header == NULL) {
+    return EFI_PROTOCOL_ERROR;
+  }
+
+  //
+  // The header (BHS and AHS) is followed by the padded data segment, if any.
+  //
+  Len       = ISCSI_GET_DATASEG_LEN (Header);
+  HeaderLen = Pdu->TotalSize - (Len + ISCSI_GET_PAD_LEN (Len));
+  if (Len == 0) {
+    DataDigest = FALSE;
+  }
+
+  //
+  // Rebuild the PDU from its fragments, with the digests inserted. One
+  // fragment may be split at the end of the header.
+  //
+  Fragment = AllocatePool ((Pdu->BlockOpNum + 3) * sizeof (NET_FRAGMENT));
+  if (Fragment == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  FragmentCount = 0;
+  Offset        = 0;
+  Crc           = 0;
+
+  for (Index = 0; Index < Pdu->BlockOpNum; Index++) {
+    Bulk = Pdu->BlockOp[Index].Head;
+    Len  = Pdu->BlockOp[Index].Size;
+
+    while (Len > 0) {
+      Chunk = (Offset < HeaderLen) ? MIN (Len, HeaderLen - Offset) : Len;
+
+      Fragment[FragmentCount].Bulk = Bulk;
+      Fragment[FragmentCount].Len  = Chunk;
+      FragmentCount++;
+
+      if ((Offset < HeaderLen) ? HeaderDigest : DataDigest) {
+        Crc = IScsiCrc32c (Crc, Bulk, Chunk);
+      }
+
+      Offset += Chunk;
+      Bulk   += Chunk;
+      Len    -= Chunk;
+
+      if ((Offset == HeaderLen) && HeaderDigest) {
+        Digest[0]                    = Crc;
+        Fragment[FragmentCount].Bulk = (UINT8 *) &Digest[0];
+        Fragment[FragmentCount].Len  = sizeof (UINT32);
+        FragmentCount++;
+        Crc                          = 0;
+      }
+    }
+  }
+
+  if (DataDigest) {
+    Digest[1]                    = Crc;
+    Fragment[FragmentCount].Bulk = (UINT8 *) &Digest[1];
+    Fragment[FragmentCount].Len  = sizeof (UINT32);
+    FragmentCount++;
+  }
+
+  //
+  // TcpIoTransmit () returns only after the transmission completes, so the
+  // digests may live on the stack.
+  //
+  DigestPdu = NetbufFromExt (Fragment, FragmentCount, 0, 0, IScsiNbufExtFree, NULL);
+  if (DigestPdu == NULL) {
+    FreePool (Fragment);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = TcpIoTransmit (&Conn->TcpIo, DigestPdu);
+
+  NetbufFree (DigestPdu);
+  FreePool (Fragment);
+
+  return Status;
+}
+
+
 /**
   Receive an iSCSI response PDU. An iSCSI response PDU contains an iSCSI PDU header and
   an optional data segment. The two parts will be put into two blocks of buffers in the
@@ -1226,6 +1381,7 @@ IScsiReceivePdu (
   UINT32          FragmentCount;
   NET_BUF         *DataSeg;
   UINT32          PadAndCRC32[2];
+  UINT32          Digest;
 
   NbufList = AllocatePool (sizeof (LIST_ENTRY));
   if (NbufList == NULL) {
@@ -1259,11 +1415,14 @@ IScsiReceivePdu (
 
   if (HeaderDigest) {
     //
-    // TODO: check the header-digest.
-    //
-    //
-    // Trim off the digest.
+    // Check the header-digest, then trim it off.
     //
+    CopyMem (&Digest, Header + sizeof (ISCSI_BASIC_HEADER), sizeof (UINT32));
+    if (Digest != IScsiCrc32c (0, Header, sizeof (ISCSI_BASIC_HEADER))) {
+      Status = EFI_PROTOCOL_ERROR;
+      goto ON_EXIT;
+    }
+
     NetbufTrim (PduHdr, sizeof (UINT32), NET_BUF_TAIL);
   }
 
@@ -1355,8 +1514,16 @@ IScsiReceivePdu (
 
   if (DataDigest) {
     //
-    // TODO: Check the data digest.
+    // Check the data digest, which covers the data and the padding bytes,
+    // then trim it off.
     //
+    Len = DataSeg->TotalSize - sizeof (UINT32);
+    NetbufCopy (DataSeg, Len, sizeof (UINT32), (UINT8 *) &Digest);
+    if (Digest != IScsiNetbufCrc32c (DataSeg, Len)) {
+      Status = EFI_PROTOCOL_ERROR;
+      goto ON_EXIT;
+    }
+
     NetbufTrim (DataSeg, sizeof (UINT32), NET_BUF_TAIL);
   }
 
@@ -1442,7 +1609,7 @@ IScsiCheckOpParams (
     goto ON_ERROR;
   }
 
-  if (AsciiStrCmp (Value, "CRC32") == 0) {
+  if (AsciiStrCmp (Value, ISCSI_KEY_VALUE_CRC32C) == 0) {
     if (Conn->HeaderDigest != IScsiDigestCRC32) {
       goto ON_ERROR;
     }
@@ -1459,7 +1626,7 @@ IScsiCheckOpParams (
     goto ON_ERROR;
   }
 
-  if (AsciiStrCmp (Value, "CRC32") == 0) {
+  if (AsciiStrCmp (Value, ISCSI_KEY_VALUE_CRC32C) == 0) {
     if (Conn->DataDigest != IScsiDigestCRC32) {
       goto ON_ERROR;
     }
@@ -1680,10 +1847,10 @@ IScsiFillOpParams (
 
   Session = Conn->Session;
 
-  AsciiSPrint (Value, sizeof (Value), "%a", (Conn->HeaderDigest == IScsiDigestCRC32) ? "None,CRC32" : "None");
+  AsciiSPrint (Value, sizeof (Value), "%a", (Conn->HeaderDigest == IScsiDigestCRC32) ? ISCSI_KEY_VALUE_NONE "," ISCSI_KEY_VALUE_CRC32C : ISCSI_KEY_VALUE_NONE);
   IScsiAddKeyValuePair (Pdu, ISCSI_KEY_HEADER_DIGEST, Value);
 
-  AsciiSPrint (Value, sizeof (Value), "%a", (Conn->DataDigest == IScsiDigestCRC32) ? "None,CRC32" : "None");
+  AsciiSPrint (Value, sizeof (Value), "%a", (Conn->DataDigest == IScsiDigestCRC32) ? ISCSI_KEY_VALUE_NONE "," ISCSI_KEY_VALUE_CRC32C : ISCSI_KEY_VALUE_NONE);
   IScsiAddKeyValuePair (Pdu, ISCSI_KEY_DATA_DIGEST, Value);
 
   AsciiSPrint (Value, sizeof (Value), "%d", Session->ErrorRecoveryLevel);
@@ -2480,7 +2647,7 @@ IScsiSendDataOutPduSequence (
   NET_LIST_FOR_EACH (Entry, DataOutPduList) {
     Pdu     = NET_LIST_USER_STRUCT (Entry, NET_BUF, List);
 
-    Status = TcpIoTransmit (&Tcb->Conn->TcpIo, Pdu);
+    Status = IScsiSendPdu (Tcb->Conn, Pdu);
 
     if (EFI_ERROR (Status)) {
       break;
@@ -2895,7 +3062,7 @@ IScsiExecuteScsiCommand (
   //
   // Transmit the SCSI Command PDU.
   //
-  Status = TcpIoTransmit (&Conn->TcpIo, Pdu);
+  Status = IScsiSendPdu (Conn, Pdu);
 
   NetbufFree (Pdu);
 
@@ -2943,7 +3110,14 @@ IScsiExecuteScsiCommand (
     //
     // Try to receive PDU from target.
     //
-    Status = IScsiReceivePdu (Conn, &Pdu, &InBufferContext, FALSE, FALSE, TimeoutEvent);
+    Status = IScsiReceivePdu (
+               Conn,
+               &Pdu,
+               &InBufferContext,
+               (BOOLEAN) (Conn->HeaderDigest == IScsiDigestCRC32),
+               (BOOLEAN) (Conn->DataDigest == IScsiDigestCRC32),
+               TimeoutEvent
+               );
     if (EFI_ERROR (Status)) {
       goto ON_EXIT;
     }
@@ -64,6 +64,7 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 #define ISCSI_KEY_MAX_RECV_DATA_SEGMENT_LENGTH  "MaxRecvDataSegmentLength"
 
 #define ISCSI_KEY_VALUE_NONE                    "None"
+#define ISCSI_KEY_VALUE_CRC32C                  "CRC32C"
 
 ///
 /// connection state for initiator
@@ -835,6 +836,24 @@ IScsiFreeNbufList (
   VOID *Arg
   );
 
+/**
+  Send an iSCSI PDU in the full feature phase, appending the header digest and
+  the data digest negotiated on the connection, if any.
+
+  @param[in]  Conn             The iSCSI connection to send the PDU on.
+  @param[in]  Pdu              The iSCSI PDU, with its data segment padded.
+
+  @retval EFI_SUCCESS          The PDU is sent.
+  @retval EFI_OUT_OF_RESOURCES Failed to allocate memory.
+  @retval Others               Other errors as indicated.
+
+**/
+EFI_STATUS
+IScsiSendPdu (
+  IN ISCSI_CONNECTION  *Conn,
+  IN NET_BUF           *Pdu
+  );
+
 /**
   Receive an iSCSI response PDU. An iSCSI response PDU contains an iSCSI PDU header and
   an optional data segment. The two parts will be put into two blocks of buffers in the
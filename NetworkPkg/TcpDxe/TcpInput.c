@@ -581,6 +581,8 @@ TcpQueueData (
   Seg   = TCPSEG_NETBUF (Nbuf);
   Head  = &Tcb->RcvQue;
 
+  Tcb->RcvLastSeq = Seg->Seq;
+
   //
   // Fast path to process normal case. That is,
   // no out-of-order segments are received.
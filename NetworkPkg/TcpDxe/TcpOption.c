@@ -165,6 +165,28 @@ TcpSynBuildOption (
     TcpPutUint32 (Data, TCP_OPTION_WS_FAST | TcpComputeScale (Tcb));
   }
 
+  //
+  // Build SACK permitted option, only when SACK isn't
+  // disabled, and either we are doing active open or
+  // we have received SACK permitted option from peer.
+  //
+  if (!TCP_FLG_ON (Tcb->CtrlFlag, TCP_CTRL_NO_SACK) &&
+      (!TCP_FLG_ON (TCPSEG_NETBUF (Nbuf)->Flag, TCP_FLG_ACK) ||
+        TCP_FLG_ON (Tcb->CtrlFlag, TCP_CTRL_SND_SACK))
+      ) {
+
+    Data = NetbufAllocSpace (
+             Nbuf,
+             TCP_OPTION_SACK_PERM_ALIGNED_LEN,
+             NET_BUF_HEAD
+             );
+
+    ASSERT (Data != NULL);
+
+    Len += TCP_OPTION_SACK_PERM_ALIGNED_LEN;
+    TcpPutUint32 (Data, TCP_OPTION_SACK_PERM_FAST);
+  }
+
   //
   // Build the MSS option.
   //
@@ -194,9 +216,11 @@ TcpBuildOption (
 {
   UINT8   *Data;
   UINT16  Len;
+  UINT32  DataLen;
 
   ASSERT ((Tcb != NULL) && (Nbuf != NULL) && (Nbuf->Tcp == NULL));
-  Len = 0;
+  Len     = 0;
+  DataLen = Nbuf->TotalSize;
 
   //
   // Build the Timestamp option.
@@ -219,6 +243,140 @@ TcpBuildOption (
     TcpPutUint32 (Data + 8, Tcb->TsRecent);
   }
 
+  //
+  // Build the SACK option to report the out-of-order data in the
+  // reassemble queue. Only add it to segments without data, the
+  // data segments have been sized to leave room for timestamp only.
+  //
+  if (TCP_FLG_ON (Tcb->CtrlFlag, TCP_CTRL_SND_SACK) &&
+      !TCP_FLG_ON (TCPSEG_NETBUF (Nbuf)->Flag, TCP_FLG_RST) &&
+      (DataLen == 0)
+      ) {
+
+    Len = (UINT16) (Len + TcpBuildSackOption (Tcb, Nbuf, (UINT16) (TCP_OPTION_MAX_LEN - Len)));
+  }
+
+  return Len;
+}
+
+/**
+  Build the SACK option from the segments in the reassemble queue.
+
+  Adjacent segments are merged into one block. As required by RFC 2018,
+  the block containing the most recently queued segment is reported first,
+  followed by the other blocks in sequence order, as many as fit in the room
+  left for options.
+
+  @param[in]  Tcb     Pointer to the TCP_CB of this TCP instance.
+  @param[in]  Nbuf    Pointer to the buffer to store the options.
+  @param[in]  Room    The number of bytes left for options in the TCP header.
+
+  @return             The total length of the SACK option, 0 if nothing to report.
+
+**/
+UINT16
+TcpBuildSackOption (
+  IN TCP_CB  *Tcb,
+  IN NET_BUF *Nbuf,
+  IN UINT16  Room
+  )
+{
+  //
+  // Slot 0 holds the block of the most recently queued segment, the other
+  // blocks are collected from slot 1 in sequence order.
+  //
+  TCP_SEQNO   Left[TCP_OPTION_MAX_SACK_BLOCK + 1];
+  TCP_SEQNO   Right[TCP_OPTION_MAX_SACK_BLOCK + 1];
+  TCP_SEQNO   BlockLeft;
+  TCP_SEQNO   BlockRight;
+  BOOLEAN     InBlock;
+  BOOLEAN     Recent;
+  UINTN       MaxBlock;
+  UINTN       Count;
+  UINTN       First;
+  UINTN       Index;
+  LIST_ENTRY  *Entry;
+  TCP_SEG     *Seg;
+  UINT8       *Data;
+  UINT16      Len;
+
+  if (Room < TCP_OPTION_SACK_ALIGNED_LEN + TCP_OPTION_SACK_BLOCK_LEN) {
+    return 0;
+  }
+
+  MaxBlock   = MIN (
+                 TCP_OPTION_MAX_SACK_BLOCK,
+                 (Room - TCP_OPTION_SACK_ALIGNED_LEN) / TCP_OPTION_SACK_BLOCK_LEN
+                 );
+  Count      = 0;
+  Recent     = FALSE;
+  InBlock    = FALSE;
+  BlockLeft  = 0;
+  BlockRight = 0;
+
+  for (Entry = Tcb->RcvQue.ForwardLink; ; Entry = Entry->ForwardLink) {
+    if (Entry != &Tcb->RcvQue) {
+      Seg = TCPSEG_NETBUF (NET_LIST_USER_STRUCT (Entry, NET_BUF, List));
+
+      if (TCP_SEQ_LEQ (Seg->Seq, Tcb->RcvNxt) || (Seg->Seq == Seg->End)) {
+        continue;
+      }
+
+      if (InBlock && TCP_SEQ_LEQ (Seg->Seq, BlockRight)) {
+        if (TCP_SEQ_GT (Seg->End, BlockRight)) {
+          BlockRight = Seg->End;
+        }
+
+        continue;
+      }
+    }
+
+    //
+    // The current block is complete, save it.
+    //
+    if (InBlock) {
+      if (!Recent && TCP_SEQ_LEQ (BlockLeft, Tcb->RcvLastSeq) && TCP_SEQ_LT (Tcb->RcvLastSeq, BlockRight)) {
+        Left[0]  = BlockLeft;
+        Right[0] = BlockRight;
+        Recent   = TRUE;
+      } else if (Count < MaxBlock) {
+        Left[Count + 1]  = BlockLeft;
+        Right[Count + 1] = BlockRight;
+        Count++;
+      }
+    }
+
+    if ((Entry == &Tcb->RcvQue) || (Recent && (Count >= MaxBlock - 1))) {
+      break;
+    }
+
+    BlockLeft  = Seg->Seq;
+    BlockRight = Seg->End;
+    InBlock    = TRUE;
+  }
+
+  if (Recent) {
+    First = 0;
+    Count = MIN (Count + 1, MaxBlock);
+  } else {
+    First = 1;
+  }
+
+  if (Count == 0) {
+    return 0;
+  }
+
+  Len  = (UINT16) (TCP_OPTION_SACK_ALIGNED_LEN + Count * TCP_OPTION_SACK_BLOCK_LEN);
+  Data = NetbufAllocSpace (Nbuf, Len, NET_BUF_HEAD);
+  ASSERT (Data != NULL);
+
+  TcpPutUint32 (Data, TCP_OPTION_SACK_FAST | (Len - 2));
+
+  for (Index = 0; Index < Count; Index++) {
+    TcpPutUint32 (Data + TCP_OPTION_SACK_ALIGNED_LEN + Index * TCP_OPTION_SACK_BLOCK_LEN, Left[First + Index]);
+    TcpPutUint32 (Data + TCP_OPTION_SACK_ALIGNED_LEN + Index * TCP_OPTION_SACK_BLOCK_LEN + 4, Right[First + Index]);
+  }
+
   return Len;
 }
 
@@ -319,6 +477,19 @@ TcpParseOption (
       Cur += TCP_OPTION_TS_LEN;
       break;
 
+    case TCP_OPTION_SACK_PERM:
+      Len = Head[Cur + 1];
+
+      if ((Len != TCP_OPTION_SACK_PERM_LEN) || (TotalLen - Cur < TCP_OPTION_SACK_PERM_LEN)) {
+
+        return -1;
+      }
+
+      TCP_SET_FLG (Option->Flag, TCP_OPTION_RCVD_SACK_PERM);
+
+      Cur += TCP_OPTION_SACK_PERM_LEN;
+      break;
+
     case TCP_OPTION_NOP:
       Cur++;
       break;
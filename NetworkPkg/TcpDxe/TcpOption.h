@@ -23,12 +23,19 @@
 #define TCP_OPTION_NOP             1  ///< No-Option.
 #define TCP_OPTION_MSS             2  ///< Maximum Segment Size
 #define TCP_OPTION_WS              3  ///< Window scale
+#define TCP_OPTION_SACK_PERM       4  ///< SACK permitted
+#define TCP_OPTION_SACK            5  ///< Selective acknowledgment
 #define TCP_OPTION_TS              8  ///< Timestamp
 #define TCP_OPTION_MSS_LEN         4  ///< Length of MSS option
 #define TCP_OPTION_WS_LEN          3  ///< Length of window scale option
+#define TCP_OPTION_SACK_PERM_LEN   2  ///< Length of SACK permitted option
 #define TCP_OPTION_TS_LEN          10 ///< Length of timestamp option
 #define TCP_OPTION_WS_ALIGNED_LEN  4  ///< Length of window scale option, aligned
+#define TCP_OPTION_SACK_PERM_ALIGNED_LEN 4 ///< Length of SACK permitted option, aligned
+#define TCP_OPTION_SACK_ALIGNED_LEN 4 ///< Length of SACK option without blocks, aligned
+#define TCP_OPTION_SACK_BLOCK_LEN  8  ///< Length of one SACK block
 #define TCP_OPTION_TS_ALIGNED_LEN  12 ///< Length of timestamp option, aligned
+#define TCP_OPTION_MAX_LEN         40 ///< Maxium length of the TCP option field
 
 //
 // recommend format of timestamp window scale
@@ -45,12 +52,23 @@
 
 #define TCP_OPTION_MSS_FAST  ((TCP_OPTION_MSS << 24) | (TCP_OPTION_MSS_LEN << 16))
 
+#define TCP_OPTION_SACK_PERM_FAST ((TCP_OPTION_NOP << 24) | \
+                                   (TCP_OPTION_NOP << 16) | \
+                                   (TCP_OPTION_SACK_PERM << 8) | \
+                                   (TCP_OPTION_SACK_PERM_LEN))
+
+#define TCP_OPTION_SACK_FAST ((TCP_OPTION_NOP << 24) | \
+                              (TCP_OPTION_NOP << 16) | \
+                              (TCP_OPTION_SACK << 8))
+
 //
 // Other misc definations
 //
 #define TCP_OPTION_RCVD_MSS        0x01
 #define TCP_OPTION_RCVD_WS         0x02
 #define TCP_OPTION_RCVD_TS         0x04
+#define TCP_OPTION_RCVD_SACK_PERM  0x08
+#define TCP_OPTION_MAX_SACK_BLOCK  4       ///< Maxium number of SACK blocks in a segment
 #define TCP_OPTION_MAX_WS          14      ///< Maxium window scale value
 #define TCP_OPTION_MAX_WIN         0xffff  ///< Max window size in TCP header
 
@@ -109,6 +127,28 @@ TcpBuildOption (
   IN NET_BUF *Nbuf
   );
 
+/**
+  Build the SACK option from the segments in the reassemble queue.
+
+  Adjacent segments are merged into one block. As required by RFC 2018,
+  the block containing the most recently queued segment is reported first,
+  followed by the other blocks in sequence order, as many as fit in the room
+  left for options.
+
+  @param[in]  Tcb     Pointer to the TCP_CB of this TCP instance.
+  @param[in]  Nbuf    Pointer to the buffer to store the options.
+  @param[in]  Room    The number of bytes left for options in the TCP header.
+
+  @return             The total length of the SACK option, 0 if nothing to report.
+
+**/
+UINT16
+TcpBuildSackOption (
+  IN TCP_CB  *Tcb,
+  IN NET_BUF *Nbuf,
+  IN UINT16  Room
+  );
+
 /**
   Parse the supported options.
 
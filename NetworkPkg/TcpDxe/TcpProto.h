@@ -78,6 +78,8 @@
 #define TCP_CTRL_TIMER_ON        0x1000 ///< At least one of the timer is on.
 #define TCP_CTRL_RTT_ON          0x2000 ///< The RTT measurement is on.
 #define TCP_CTRL_ACK_NOW         0x4000 ///< Send the ACK now, don't delay.
+#define TCP_CTRL_NO_SACK         0x8000 ///< Disable SACK option.
+#define TCP_CTRL_SND_SACK        0x10000 ///< Received a SACK permitted option in syn, send SACK to remote.
 
 //
 // Timer related values
@@ -274,6 +276,8 @@ struct _TCP_CONTROL_BLOCK {
   UINT32            RcvWnd;     ///< Window advertised by the local peer.
   TCP_SEQNO         RcvWl2;     ///< The RcvNxt (or ACK) of last window update.
                                 ///< It is necessary because of delayed ACK.
+  TCP_SEQNO         RcvLastSeq; ///< Seq of the most recently queued segment,
+                                ///< its SACK block is reported first.
 
   TCP_SEQNO         RcvUp;                   ///< Urgent point;
   TCP_SEQNO         Irs;                     ///< Initial Receiving Sequence.
@@ -107,7 +107,8 @@ typedef struct {
   volatile UINT16 *Idx;
 
   volatile UINT16 *Ring;      // QueueSize elements
-  volatile UINT16 *UsedEvent; // unused as per negotiation
+  volatile UINT16 *UsedEvent; // only with VIRTIO_F_RING_EVENT_IDX; left
+                              // unset, interrupts are not used
 } VRING_AVAIL;
 
 
@@ -127,7 +128,8 @@ typedef struct {
   volatile UINT16          *Flags;
   volatile UINT16          *Idx;
   volatile VRING_USED_ELEM *UsedElem;   // QueueSize elements
-  volatile UINT16          *AvailEvent; // unused as per negotiation
+  volatile UINT16          *AvailEvent; // only with VIRTIO_F_RING_EVENT_IDX;
+                                        // read to suppress notifications
 } VRING_USED;
 
 
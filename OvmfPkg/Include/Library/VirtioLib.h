@@ -182,4 +182,42 @@ VirtioFlush (
   IN     DESC_INDICES           *Indices
   );
 
+
+/**
+
+  Notify the host about several descriptor chains just built, and wait until
+  the host processes all of them.
+
+  The chains are placed on the Available Ring in the order given, and the host
+  is notified once. This allows the host to work on the chains in parallel.
+
+  @param[in] VirtIo       The target virtio device to notify.
+
+  @param[in] VirtQueueId  Identifies the queue for the target device.
+
+  @param[in,out] Ring     The virtio ring with descriptors to submit.
+
+  @param[in] ChainCount   Number of descriptor chains to submit. The caller is
+                          responsible for having built all chains in disjoint
+                          descriptors of the ring.
+
+  @param[in] HeadDescIdx  Array of ChainCount elements, identifying the head
+                          descriptor of each descriptor chain.
+
+
+  @return              Error code from VirtIo->SetQueueNotify() if it fails.
+
+  @retval EFI_SUCCESS  Otherwise, the host processed all descriptors.
+
+**/
+EFI_STATUS
+EFIAPI
+VirtioFlushChains (
+  IN     VIRTIO_DEVICE_PROTOCOL *VirtIo,
+  IN     UINT16                 VirtQueueId,
+  IN OUT VRING                  *Ring,
+  IN     UINT16                 ChainCount,
+  IN     CONST UINT16           *HeadDescIdx
+  );
+
 #endif // _VIRTIO_LIB_H_
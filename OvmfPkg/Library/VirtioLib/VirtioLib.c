@@ -169,8 +169,9 @@ VirtioPrepare (
   //
   // Prepare for virtio-0.9.5, 2.4.1 Supplying Buffers to the Device.
   //
-  // Since we support only one in-flight descriptor chain, we can always build
-  // that chain starting at entry #0 of the descriptor table.
+  // Since all in-flight descriptor chains are processed by the host before the
+  // next ones are prepared, we can always build them starting at entry #0 of
+  // the descriptor table.
   //
   Indices->HeadDescIdx = 0;
   Indices->NextDescIdx = Indices->HeadDescIdx;
@@ -263,8 +264,51 @@ VirtioFlush (
   IN OUT VRING                  *Ring,
   IN     DESC_INDICES           *Indices
   )
+{
+  return VirtioFlushChains (VirtIo, VirtQueueId, Ring, 1,
+           &Indices->HeadDescIdx);
+}
+
+
+/**
+
+  Notify the host about several descriptor chains just built, and wait until
+  the host processes all of them.
+
+  The chains are placed on the Available Ring in the order given, and the host
+  is notified once. This allows the host to work on the chains in parallel.
+
+  @param[in] VirtIo       The target virtio device to notify.
+
+  @param[in] VirtQueueId  Identifies the queue for the target device.
+
+  @param[in,out] Ring     The virtio ring with descriptors to submit.
+
+  @param[in] ChainCount   Number of descriptor chains to submit. The caller is
+                          responsible for having built all chains in disjoint
+                          descriptors of the ring.
+
+  @param[in] HeadDescIdx  Array of ChainCount elements, identifying the head
+                          descriptor of each descriptor chain.
+
+
+  @return              Error code from VirtIo->SetQueueNotify() if it fails.
+
+  @retval EFI_SUCCESS  Otherwise, the host processed all descriptors.
+
+**/
+EFI_STATUS
+EFIAPI
+VirtioFlushChains (
+  IN     VIRTIO_DEVICE_PROTOCOL *VirtIo,
+  IN     UINT16                 VirtQueueId,
+  IN OUT VRING                  *Ring,
+  IN     UINT16                 ChainCount,
+  IN     CONST UINT16           *HeadDescIdx
+  )
 {
   UINT16     NextAvailIdx;
+  UINT16     ChainIdx;
   EFI_STATUS Status;
   UINTN      PollPeriodUsecs;
 
@@ -276,8 +320,10 @@ VirtioFlush (
   // head descriptor of any given descriptor chain.
   //
   NextAvailIdx = *Ring->Avail.Idx;
-  Ring->Avail.Ring[NextAvailIdx++ % Ring->QueueSize] =
-    Indices->HeadDescIdx % Ring->QueueSize;
+  for (ChainIdx = 0; ChainIdx < ChainCount; ++ChainIdx) {
+    Ring->Avail.Ring[NextAvailIdx++ % Ring->QueueSize] =
+      HeadDescIdx[ChainIdx] % Ring->QueueSize;
+  }
 
   //
   // virtio-0.9.5, 2.4.1.3 Updating the Index Field
@@ -297,7 +343,7 @@ VirtioFlush (
 
   //
   // virtio-0.9.5, 2.4.2 Receiving Used Buffers From the Device
-  // Wait until the host processes and acknowledges our descriptor chain. The
+  // Wait until the host processes and acknowledges our descriptor chains. The
   // condition we use for polling is greatly simplified and relies on the
   // synchronous, lock-step progress.
   //
@@ -8,7 +8,9 @@
 
   - Although the non-blocking interfaces of EFI_BLOCK_IO2_PROTOCOL could be a
     good match for multiple in-flight virtio-blk requests, we stick to
-    synchronous requests and EFI_BLOCK_IO_PROTOCOL for now.
+    synchronous requests and EFI_BLOCK_IO_PROTOCOL for now. Large transfers
+    are still submitted as several virtio-blk requests at once, so that the
+    host can process them in parallel.
 
   Copyright (C) 2012, Red Hat, Inc.
   Copyright (c) 2012 - 2014, Intel Corporation. All rights reserved.<BR>
@@ -186,6 +188,10 @@ VerifyReadWriteRequest (
   Format a read / write / flush request as three consecutive virtio
   descriptors, push them to the host, and poll for the response.
 
+  A read / write request larger than VBLK_REQUEST_SIZE is split into several
+  virtio-blk requests, up to Dev->MaxRequests of which are pushed to the host
+  together.
+
   This is the main workhorse function. Two use cases are supported, read/write
   and flush. The function may only be called after the request parameters have
   been verified by
@@ -247,8 +253,14 @@ SynchronousRequest (
   )
 {
   UINT32                  BlockSize;
-  volatile VIRTIO_BLK_REQ Request;
-  volatile UINT8          HostStatus;
+  UINTN                   RequestSize;
+  UINTN                   ChunkSize;
+  UINTN                   Offset;
+  UINT16                  Count;
+  UINT16                  Idx;
+  volatile VIRTIO_BLK_REQ Request[VBLK_MAX_REQUESTS];
+  volatile UINT8          HostStatus[VBLK_MAX_REQUESTS];
+  UINT16                  HeadDescIdx[VBLK_MAX_REQUESTS];
   DESC_INDICES            Indices;
 
   BlockSize = Dev->BlockIoMedia.BlockSize;
@@ -264,72 +276,108 @@ SynchronousRequest (
   //
   ASSERT (BufferSize % BlockSize == 0);
 
-  //
-  // Prepare virtio-blk request header, setting zero size for flush.
-  // IO Priority is homogeneously 0.
-  //
-  Request.Type   = RequestIsWrite ?
-                   (BufferSize == 0 ? VIRTIO_BLK_T_FLUSH : VIRTIO_BLK_T_OUT) :
-                   VIRTIO_BLK_T_IN;
-  Request.IoPrio = 0;
-  Request.Sector = MultU64x32(Lba, BlockSize / 512);
-
-  VirtioPrepare (&Dev->Ring, &Indices);
-
-  //
-  // preset a host status for ourselves that we do not accept as success
-  //
-  HostStatus = VIRTIO_BLK_S_IOERR;
-
   //
   // ensured by VirtioBlkInit() -- this predicate, in combination with the
   // lock-step progress, ensures we don't have to track free descriptors.
   //
-  ASSERT (Dev->Ring.QueueSize >= 3);
+  ASSERT (Dev->MaxRequests > 0);
+  ASSERT (Dev->MaxRequests <= VBLK_MAX_REQUESTS);
+  ASSERT (Dev->Ring.QueueSize >= 3 * Dev->MaxRequests);
 
   //
-  // virtio-blk header in first desc
+  // Each virtio-blk request transfers a whole number of blocks.
   //
-  VirtioAppendDesc (&Dev->Ring, (UINTN) &Request, sizeof Request,
-    VRING_DESC_F_NEXT, &Indices);
+  RequestSize = VBLK_REQUEST_SIZE - VBLK_REQUEST_SIZE % BlockSize;
+  if (RequestSize == 0) {
+    RequestSize = BlockSize;
+  }
+
+  Offset = 0;
+  do {
+    VirtioPrepare (&Dev->Ring, &Indices);
 
-  //
-  // data buffer for read/write in second desc
-  //
-  if (BufferSize > 0) {
-    //
-    // From virtio-0.9.5, 2.3.2 Descriptor Table:
-    // "no descriptor chain may be more than 2^32 bytes long in total".
     //
-    // The predicate is ensured by the call contract above (for flush), or
-    // VerifyReadWriteRequest() (for read/write). It also implies that
-    // converting BufferSize to UINT32 will not truncate it.
+    // A flush request is sent on its own, with zero data size.
     //
-    ASSERT (BufferSize <= SIZE_1GB);
+    for (Count = 0;
+         Count < Dev->MaxRequests && (Count == 0 || Offset < BufferSize);
+         ++Count) {
+      ChunkSize = MIN (RequestSize, BufferSize - Offset);
+
+      //
+      // Prepare virtio-blk request header, setting zero size for flush.
+      // IO Priority is homogeneously 0.
+      //
+      Request[Count].Type   = RequestIsWrite ?
+                              (BufferSize == 0 ? VIRTIO_BLK_T_FLUSH :
+                                                 VIRTIO_BLK_T_OUT) :
+                              VIRTIO_BLK_T_IN;
+      Request[Count].IoPrio = 0;
+      Request[Count].Sector = MultU64x32 (Lba + Offset / BlockSize,
+                                BlockSize / 512);
+
+      //
+      // preset a host status for ourselves that we do not accept as success
+      //
+      HostStatus[Count] = VIRTIO_BLK_S_IOERR;
+
+      HeadDescIdx[Count]  = Indices.NextDescIdx;
+      Indices.HeadDescIdx = Indices.NextDescIdx;
+
+      //
+      // virtio-blk header in first desc
+      //
+      VirtioAppendDesc (&Dev->Ring, (UINTN) &Request[Count],
+        sizeof Request[Count], VRING_DESC_F_NEXT, &Indices);
+
+      //
+      // data buffer for read/write in second desc
+      //
+      if (ChunkSize > 0) {
+        //
+        // From virtio-0.9.5, 2.3.2 Descriptor Table:
+        // "no descriptor chain may be more than 2^32 bytes long in total".
+        //
+        // The predicate is ensured by the call contract above (for flush), or
+        // VerifyReadWriteRequest() (for read/write). It also implies that
+        // converting ChunkSize to UINT32 will not truncate it.
+        //
+        ASSERT (ChunkSize <= SIZE_1GB);
+
+        //
+        // VRING_DESC_F_WRITE is interpreted from the host's point of view.
+        //
+        VirtioAppendDesc (&Dev->Ring, (UINTN) Buffer + Offset,
+          (UINT32) ChunkSize,
+          VRING_DESC_F_NEXT | (RequestIsWrite ? 0 : VRING_DESC_F_WRITE),
+          &Indices);
+      }
+
+      //
+      // host status in last (second or third) desc
+      //
+      VirtioAppendDesc (&Dev->Ring, (UINTN) &HostStatus[Count],
+        sizeof HostStatus[Count], VRING_DESC_F_WRITE, &Indices);
+
+      Offset += ChunkSize;
+    }
 
     //
-    // VRING_DESC_F_WRITE is interpreted from the host's point of view.
+    // virtio-blk's only virtqueue is #0, called "requestq" (see Appendix D).
     //
-    VirtioAppendDesc (&Dev->Ring, (UINTN) Buffer, (UINT32) BufferSize,
-      VRING_DESC_F_NEXT | (RequestIsWrite ? 0 : VRING_DESC_F_WRITE),
-      &Indices);
-  }
-
-  //
-  // host status in last (second or third) desc
-  //
-  VirtioAppendDesc (&Dev->Ring, (UINTN) &HostStatus, sizeof HostStatus,
-    VRING_DESC_F_WRITE, &Indices);
+    if (VirtioFlushChains (Dev->VirtIo, 0, &Dev->Ring, Count, HeadDescIdx) !=
+        EFI_SUCCESS) {
+      return EFI_DEVICE_ERROR;
+    }
 
-  //
-  // virtio-blk's only virtqueue is #0, called "requestq" (see Appendix D).
-  //
-  if (VirtioFlush (Dev->VirtIo, 0, &Dev->Ring, &Indices) == EFI_SUCCESS &&
-      HostStatus == VIRTIO_BLK_S_OK) {
-    return EFI_SUCCESS;
-  }
+    for (Idx = 0; Idx < Count; ++Idx) {
+      if (HostStatus[Idx] != VIRTIO_BLK_S_OK) {
+        return EFI_DEVICE_ERROR;
+      }
+    }
+  } while (Offset < BufferSize);
 
-  return EFI_DEVICE_ERROR;
+  return EFI_SUCCESS;
 }
 
 
@@ -707,6 +755,12 @@ VirtioBlkInit (
     goto Failed;
   }
 
+  //
+  // ... per virtio-blk request; limit the requests submitted together so that
+  // they fit in the ring
+  //
+  Dev->MaxRequests = (UINT16) MIN (QueueSize / 3, VBLK_MAX_REQUESTS);
+
   Status = VirtioRingInit (QueueSize, &Dev->Ring);
   if (EFI_ERROR (Status)) {
     goto Failed;
@@ -27,6 +27,13 @@
 
 #define VBLK_SIG SIGNATURE_32 ('V', 'B', 'L', 'K')
 
+//
+// Large transfers are split into requests of at most VBLK_REQUEST_SIZE bytes,
+// and up to VBLK_MAX_REQUESTS of those are submitted to the host at once.
+//
+#define VBLK_REQUEST_SIZE SIZE_1MB
+#define VBLK_MAX_REQUESTS 8
+
 typedef struct {
   //
   // Parts of this structure are initialized / torn down in various functions
@@ -40,6 +47,7 @@ typedef struct {
   VRING                  Ring;                 // VirtioRingInit      2
   EFI_BLOCK_IO_PROTOCOL  BlockIo;              // VirtioBlkInit       1
   EFI_BLOCK_IO_MEDIA     BlockIoMedia;         // VirtioBlkInit       1
+  UINT16                 MaxRequests;          // VirtioBlkInit       1
 } VBLK_DEV;
 
 #define VIRTIO_BLK_FROM_BLOCK_IO(BlockIoPointer) \
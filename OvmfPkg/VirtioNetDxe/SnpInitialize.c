@@ -142,7 +142,7 @@ VirtioNetInitTx (
   UINTN PktIdx;
 
   Dev->TxMaxPending = (UINT16) MIN (Dev->TxRing.QueueSize / 2,
-                                 VNET_MAX_PENDING);
+                                 VNET_MAX_TX_PENDING);
   Dev->TxCurPending = 0;
   Dev->TxFreeStack  = AllocatePool (Dev->TxMaxPending *
                         sizeof *Dev->TxFreeStack);
@@ -186,7 +186,9 @@ VirtioNetInitTx (
   ASSERT (Dev->TxLastUsed == 0);
 
   //
-  // want no interrupt when a transmit completes
+  // want no interrupt when a transmit completes (with VIRTIO_F_RING_EVENT_IDX,
+  // the host ignores this flag, and interrupts only when the Used Index passes
+  // the zero-initialized Used Event, which we don't service either)
   //
   *Dev->TxRing.Avail.Flags = (UINT16) VRING_AVAIL_F_NO_INTERRUPT;
 
@@ -298,6 +300,7 @@ VirtioNetInitRx (
   //
   MemoryFence ();
   *Dev->RxRing.Avail.Idx = RxAlwaysPending;
+  Dev->RxAvailIdx        = RxAlwaysPending;
 
   //
   // At this point reception may already be running. In order to make it sure,
@@ -432,9 +435,11 @@ VirtioNetInitialize (
   }
 
   //
-  // step 5 -- keep only the features we want
+  // step 5 -- keep only the features we want; the event index lets the host
+  // suppress queue notifications while it is processing the rings anyway
   //
-  Features &= VIRTIO_NET_F_MAC | VIRTIO_NET_F_STATUS;
+  Features &= VIRTIO_NET_F_MAC | VIRTIO_NET_F_STATUS | VIRTIO_F_RING_EVENT_IDX;
+  Dev->EventIdx = (BOOLEAN) ((Features & VIRTIO_F_RING_EVENT_IDX) != 0);
   Status = Dev->VirtIo->SetGuestFeatures (Dev->VirtIo, Features);
   if (EFI_ERROR (Status)) {
     goto ReleaseTxRing;
@@ -80,7 +80,6 @@ VirtioNetReceive (
   UINT32     RxLen;
   UINTN      OrigBufferSize;
   UINT8      *RxPtr;
-  UINT16     AvailIdx;
   EFI_STATUS NotifyStatus;
 
   if (This == NULL || BufferSize == NULL || Buffer == NULL) {
@@ -169,17 +168,21 @@ RecycleDesc:
   //
   // virtio-0.9.5, 2.4.1 Supplying Buffers to The Device
   //
-  AvailIdx = *Dev->RxRing.Avail.Idx;
-  Dev->RxRing.Avail.Ring[AvailIdx++ % Dev->RxRing.QueueSize] =
+  // The recycled descriptor chain stays invisible to the host until the
+  // Available Index is updated. That happens in bulk, when the used ring has
+  // been drained, or when enough chains have been recycled.
+  //
+  Dev->RxRing.Avail.Ring[Dev->RxAvailIdx++ % Dev->RxRing.QueueSize] =
     (UINT16) DescIdx;
 
-  MemoryFence ();
-  *Dev->RxRing.Avail.Idx = AvailIdx;
-
-  MemoryFence ();
-  NotifyStatus = Dev->VirtIo->SetQueueNotify (Dev->VirtIo, VIRTIO_NET_Q_RX);
-  if (!EFI_ERROR (Status)) { // earlier error takes precedence
-    Status = NotifyStatus;
+  if (Dev->RxLastUsed == RxCurUsed ||
+      (UINT16) (Dev->RxAvailIdx - *Dev->RxRing.Avail.Idx) >=
+      VNET_RX_REFILL_BATCH) {
+    NotifyStatus = VirtioNetFlushAvail (Dev, VIRTIO_NET_Q_RX, &Dev->RxRing,
+                     Dev->RxAvailIdx);
+    if (!EFI_ERROR (Status)) { // earlier error takes precedence
+      Status = NotifyStatus;
+    }
   }
 
 Exit:
@@ -14,6 +14,7 @@
 
 **/
 
+#include <Library/BaseLib.h>
 #include <Library/MemoryAllocationLib.h>
 
 #include "VirtioNet.h"
@@ -51,3 +52,68 @@ VirtioNetShutdownTx (
 {
   FreePool (Dev->TxFreeStack);
 }
+
+
+/**
+  Make new entries of an available ring visible to the host, and notify the
+  host about them unless it has asked not to be notified.
+
+  The entries between the current Available Index and NewAvailIdx must have
+  been written to the available ring by the caller. Skipping the notification
+  when the host is still processing the ring saves a VM exit per packet.
+
+  @param[in,out] Dev          The VNET_DEV driver instance.
+  @param[in]     Selector     Identifies the virtio queue of Ring.
+  @param[in,out] Ring         The virtio-ring inside the VNET_DEV structure,
+                              corresponding to Selector.
+  @param[in]     NewAvailIdx  The new value of the Available Index.
+
+  @return  Status codes from VIRTIO_DEVICE_PROTOCOL.SetQueueNotify().
+  @retval EFI_SUCCESS  The entries have been published, and the host has been
+                       notified if necessary.
+*/
+
+EFI_STATUS
+EFIAPI
+VirtioNetFlushAvail (
+  IN OUT VNET_DEV *Dev,
+  IN     UINT16   Selector,
+  IN OUT VRING    *Ring,
+  IN     UINT16   NewAvailIdx
+  )
+{
+  UINT16 OldAvailIdx;
+  UINT16 AvailEvent;
+
+  //
+  // the available index is never written by the host, we can read it back
+  // without a barrier
+  //
+  OldAvailIdx = *Ring->Avail.Idx;
+
+  //
+  // virtio-0.9.5, 2.4.1.3 Updating the Index Field
+  //
+  MemoryFence ();
+  *Ring->Avail.Idx = NewAvailIdx;
+
+  //
+  // virtio-0.9.5, 2.4.1.4 Notifying the Device -- the new index must be
+  // visible to the host before we look at its suppression hints
+  //
+  MemoryFence ();
+  if (Dev->EventIdx) {
+    //
+    // notify only if the index has just stepped over the Available Event that
+    // the host is waiting for
+    //
+    AvailEvent = *Ring->Used.AvailEvent;
+    if ((UINT16) (NewAvailIdx - AvailEvent - 1) >=
+        (UINT16) (NewAvailIdx - OldAvailIdx)) {
+      return EFI_SUCCESS;
+    }
+  } else if ((*Ring->Used.Flags & VRING_USED_F_NO_NOTIFY) != 0) {
+    return EFI_SUCCESS;
+  }
+  return Dev->VirtIo->SetQueueNotify (Dev->VirtIo, Selector);
+}
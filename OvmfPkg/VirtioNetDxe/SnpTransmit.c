@@ -157,11 +157,7 @@ VirtioNetTransmit (
   AvailIdx = *Dev->TxRing.Avail.Idx;
   Dev->TxRing.Avail.Ring[AvailIdx++ % Dev->TxRing.QueueSize] = DescIdx;
 
-  MemoryFence ();
-  *Dev->TxRing.Avail.Idx = AvailIdx;
-
-  MemoryFence ();
-  Status = Dev->VirtIo->SetQueueNotify (Dev->VirtIo, VIRTIO_NET_Q_TX);
+  Status = VirtioNetFlushAvail (Dev, VIRTIO_NET_Q_TX, &Dev->TxRing, AvailIdx);
 
 Exit:
   gBS->RestoreTPL (OldTpl);
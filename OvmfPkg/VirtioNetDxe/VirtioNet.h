@@ -29,9 +29,17 @@
 #define VNET_SIG SIGNATURE_32 ('V', 'N', 'E', 'T')
 
 //
-// maximum number of pending packets, separately for each direction
+// maximum number of pending packets: VNET_MAX_PENDING for the RX queue,
+// VNET_MAX_TX_PENDING for the TX queue
 //
-#define VNET_MAX_PENDING 64
+#define VNET_MAX_PENDING    64
+#define VNET_MAX_TX_PENDING 128
+
+//
+// number of received packets whose descriptor chains are recycled before the
+// host is offered them again, unless the used ring runs empty first
+//
+#define VNET_RX_REFILL_BATCH 16
 
 //
 // State diagram:
@@ -80,10 +88,12 @@ typedef struct {
   EFI_EVENT                   ExitBoot;          // VirtioNetSnpPopulate
   EFI_DEVICE_PATH_PROTOCOL    *MacDevicePath;    // VirtioNetDriverBindingStart
   EFI_HANDLE                  MacHandle;         // VirtioNetDriverBindingStart
+  BOOLEAN                     EventIdx;          // VirtioNetInitialize
 
   VRING                       RxRing;            // VirtioNetInitRing
   UINT8                       *RxBuf;            // VirtioNetInitRx
   UINT16                      RxLastUsed;        // VirtioNetInitRx
+  UINT16                      RxAvailIdx;        // VirtioNetInitRx
 
   VRING                       TxRing;            // VirtioNetInitRing
   UINT16                      TxMaxPending;      // VirtioNetInitTx
@@ -263,6 +273,15 @@ VirtioNetShutdownTx (
   IN OUT VNET_DEV *Dev
   );
 
+EFI_STATUS
+EFIAPI
+VirtioNetFlushAvail (
+  IN OUT VNET_DEV *Dev,
+  IN     UINT16   Selector,
+  IN OUT VRING    *Ring,
+  IN     UINT16   NewAvailIdx
+  );
+
 //
 // event callbacks
 //
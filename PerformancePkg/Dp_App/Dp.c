@@ -82,7 +82,8 @@ PARAM_ITEM_LIST  ParamList[] = {
   {STRING_TOKEN (STR_DP_OPTION_LX), TypeFlag},   // -x   eXclude Cumulative Items
   {STRING_TOKEN (STR_DP_OPTION_LI), TypeFlag},   // -i   Display Identifier
   {STRING_TOKEN (STR_DP_OPTION_LN), TypeValue},  // -n # Number of records to display for A and R
-  {STRING_TOKEN (STR_DP_OPTION_LT), TypeValue}   // -t # Threshold of interest
+  {STRING_TOKEN (STR_DP_OPTION_LT), TypeValue},  // -t # Threshold of interest
+  {STRING_TOKEN (STR_DP_OPTION_LC), TypeValue}   // -c File  Export Chrome trace
   };
 
 ///@}
@@ -138,6 +139,7 @@ ShowHelp( void )
   PrintToken (STRING_TOKEN (STR_DP_HELP_THRESHOLD));
   PrintToken (STRING_TOKEN (STR_DP_HELP_COUNT));
   PrintToken (STRING_TOKEN (STR_DP_HELP_ID));
+  PrintToken (STRING_TOKEN (STR_DP_HELP_EXPORT));
   PrintToken (STRING_TOKEN (STR_DP_HELP_HELP));
   Print(L"\n");
 }
@@ -218,6 +220,8 @@ InitializeDp (
   EFI_STRING                StringDpOptionLn;
   EFI_STRING                StringDpOptionLt;
   EFI_STRING                StringDpOptionLi;
+  EFI_STRING                StringDpOptionLc;
+  CONST CHAR16              *ExportFileName;
   
   SummaryMode     = FALSE;
   VerboseMode     = FALSE;
@@ -241,6 +245,8 @@ InitializeDp (
   StringDpOptionLn = NULL;
   StringDpOptionLt = NULL;
   StringDpOptionLi = NULL;
+  StringDpOptionLc = NULL;
+  ExportFileName   = NULL;
   StringPtr        = NULL;
 
   // Get DP's entry time as soon as possible.
@@ -289,6 +295,7 @@ InitializeDp (
       StringDpOptionLn = HiiGetString (gHiiHandle, STRING_TOKEN (STR_DP_OPTION_LN), NULL);
       StringDpOptionLt = HiiGetString (gHiiHandle, STRING_TOKEN (STR_DP_OPTION_LT), NULL);
       StringDpOptionLi = HiiGetString (gHiiHandle, STRING_TOKEN (STR_DP_OPTION_LI), NULL);
+      StringDpOptionLc = HiiGetString (gHiiHandle, STRING_TOKEN (STR_DP_OPTION_LC), NULL);
       
       // Boolean Options
       // 
@@ -322,6 +329,7 @@ InitializeDp (
       else {
         mInterestThreshold = StrDecimalToUint64(CmdLineArg);
       }
+      ExportFileName = ShellCommandLineGetValue (ParamPackage, StringDpOptionLc);
       // Handle Flag combinations and default behaviors
       // If both TraceMode and ProfileMode are FALSE, set them both to TRUE
       if ((! TraceMode) && (! ProfileMode)) {
@@ -393,7 +401,16 @@ InitializeDp (
 ****     T &&  P  := (3) Same as Default, both are displayed
 ****************************************************************************/
       GatherStatistics();
-      if (AllMode) {
+      if (ExportFileName != NULL) {
+        //
+        // Export the whole timeline for host side analysis instead of displaying it.
+        //
+        Status = ExportChromeTrace (ExportFileName);
+        if (EFI_ERROR (Status)) {
+          PrintToken (STRING_TOKEN (STR_DP_EXPORT_FAILED), ExportFileName, Status);
+        }
+      }
+      else if (AllMode) {
         if (TraceMode) {
           DumpAllTrace( Number2Display, ExcludeMode);
         }
@@ -455,6 +472,7 @@ InitializeDp (
   SafeFreePool (StringDpOptionLn);
   SafeFreePool (StringDpOptionLt);
   SafeFreePool (StringDpOptionLi);
+  SafeFreePool (StringDpOptionLc);
   SafeFreePool (StringPtr);
   SafeFreePool (mPrintTokenBuffer);
 
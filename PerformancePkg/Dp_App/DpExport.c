@@ -0,0 +1,271 @@
+/** @file
+  Chrome trace export for the Dp utility.
+
+  Writes every Trace measurement record as a "complete" event in the
+  Trace Event Format understood by chrome://tracing and compatible viewers,
+  so that the boot timeline, including nested measurements, can be inspected
+  graphically on a host.
+
+  Copyright (c) 2026, agent <agent@local>. All rights reserved.<BR>
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+**/
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/DebugLib.h>
+#include <Library/ShellLib.h>
+#include <Library/TimerLib.h>
+#include <Library/PerformanceLib.h>
+#include <Library/PrintLib.h>
+#include <Library/HiiLib.h>
+
+#include <Guid/Performance.h>
+
+#include "Dp.h"
+#include "Literals.h"
+#include "DpInternal.h"
+
+#define DP_EXPORT_LINE_LENGTH   512
+
+/**
+  Copy an ASCII string into a JSON string body, escaping as required.
+
+  Quotes and backslashes are escaped and control characters are dropped.
+  The destination is always NUL terminated and never overrun.
+
+  @param[out] Destination   Buffer receiving the escaped string.
+  @param[in]  DestMax       Size of Destination in characters.
+  @param[in]  Source        NUL terminated ASCII string to escape.  May be NULL.
+
+**/
+STATIC
+VOID
+JsonEscapeString (
+  OUT CHAR8         *Destination,
+  IN  UINTN         DestMax,
+  IN  CONST CHAR8   *Source
+  )
+{
+  UINTN   Index;
+
+  Index = 0;
+  while ((Source != NULL) && (*Source != '\0') && (Index + 2 < DestMax)) {
+    if ((*Source == '"') || (*Source == '\\')) {
+      Destination[Index++] = '\\';
+      Destination[Index++] = *Source;
+    } else if ((UINT8) *Source >= ' ') {
+      Destination[Index++] = *Source;
+    }
+    Source++;
+  }
+  Destination[Index] = '\0';
+}
+
+/**
+  Convert a measurement time stamp to microseconds since the timer started.
+
+  @param[in]  TimeStamp   The raw performance counter value.
+
+  @return     The elapsed time, in microseconds, from the timer's starting count.
+**/
+STATIC
+UINT64
+TimeStampInMicroSeconds (
+  IN UINT64   TimeStamp
+  )
+{
+  UINT64    Ticks;
+
+  if (TimerInfo.CountUp) {
+    Ticks = (TimeStamp >= TimerInfo.StartCount) ? TimeStamp - TimerInfo.StartCount : 0;
+  } else {
+    Ticks = (TimerInfo.StartCount >= TimeStamp) ? TimerInfo.StartCount - TimeStamp : 0;
+  }
+  return DurationInMicroSeconds (Ticks);
+}
+
+/**
+  Select the viewer track for a measurement.
+
+  Phases, PEIMs, image/driver handle measurements and other global
+  measurements are placed on separate tracks so that each one nests cleanly.
+
+  @param[in]  Measurement   A pointer to the measurement record.
+
+  @return     The "tid" value used for the record.
+**/
+STATIC
+UINTN
+GetTraceTrack (
+  IN MEASUREMENT_RECORD   *Measurement
+  )
+{
+  if (IsPhase (Measurement)) {
+    return 0;
+  }
+  if (AsciiStrnCmp (Measurement->Token, ALit_PEIM, PERF_TOKEN_LENGTH) == 0) {
+    return 1;
+  }
+  if (Measurement->Handle != NULL) {
+    return 2;
+  }
+  return 3;
+}
+
+/**
+  Write an ASCII string to the export file.
+
+  @param[in]  FileHandle    The open export file.
+  @param[in]  String        The NUL terminated string to write.
+
+  @return     Status from ShellWriteFile().
+**/
+STATIC
+EFI_STATUS
+WriteAsciiString (
+  IN SHELL_FILE_HANDLE  FileHandle,
+  IN CHAR8              *String
+  )
+{
+  UINTN   Size;
+
+  Size = AsciiStrLen (String);
+  return ShellWriteFile (FileHandle, &Size, String);
+}
+
+/**
+  Export all Trace measurements to a file in Chrome trace JSON format.
+
+  Complete measurements are written as "X" (complete) events with their
+  start time and duration in microseconds.  Measurements without an end
+  time are written as "i" (instant) events.  The token, module, resolved
+  driver name and identifier of each record are carried in the event.
+
+  @pre    TimerInfo must be initialized.
+          The mGaugeString global array is used for temporary string storage.
+          It must not be in use by a calling function.
+
+  @param[in]    FileName    Name of the file to create.  An existing file is replaced.
+
+  @retval EFI_SUCCESS       All records were written.
+  @retval other             The file could not be created or written.
+**/
+EFI_STATUS
+ExportChromeTrace (
+  IN CONST CHAR16   *FileName
+  )
+{
+  EFI_STATUS                Status;
+  SHELL_FILE_HANDLE         FileHandle;
+  MEASUREMENT_RECORD        Measurement;
+  UINTN                     LogEntryKey;
+  UINTN                     Count;
+  UINT64                    StartTime;
+  UINT64                    Duration;
+  CHAR8                     *Line;
+  CHAR8                     Token[PERF_TOKEN_LENGTH * 2 + 1];
+  CHAR8                     Module[PERF_TOKEN_LENGTH * 2 + 1];
+  CHAR8                     AsciiName[DP_GAUGE_STRING_LENGTH + 1];
+  CHAR8                     Name[DP_GAUGE_STRING_LENGTH * 2 + 1];
+
+  Line = AllocatePool (DP_EXPORT_LINE_LENGTH);
+  if (Line == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  //
+  // Replace any previous export.
+  //
+  Status = ShellOpenFileByName (FileName, &FileHandle, EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE, 0);
+  if (!EFI_ERROR (Status)) {
+    ShellDeleteFile (&FileHandle);
+  }
+  Status = ShellOpenFileByName (FileName, &FileHandle, EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE | EFI_FILE_MODE_CREATE, 0);
+  if (EFI_ERROR (Status)) {
+    FreePool (Line);
+    return Status;
+  }
+
+  Status = WriteAsciiString (FileHandle, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+  LogEntryKey = 0;
+  Count       = 0;
+  while (!EFI_ERROR (Status) &&
+         ((LogEntryKey = GetPerformanceMeasurementEx (
+                           LogEntryKey,
+                           &Measurement.Handle,
+                           &Measurement.Token,
+                           &Measurement.Module,
+                           &Measurement.StartTimeStamp,
+                           &Measurement.EndTimeStamp,
+                           &Measurement.Identifier)) != 0))
+  {
+    if (Measurement.StartTimeStamp == 1) {
+      Measurement.StartTimeStamp = TimerInfo.StartCount;
+    }
+    StartTime = TimeStampInMicroSeconds (Measurement.StartTimeStamp);
+
+    JsonEscapeString (Token, sizeof (Token), Measurement.Token);
+    JsonEscapeString (Module, sizeof (Module), Measurement.Module);
+    AsciiName[0] = '\0';
+    if (Measurement.Handle != NULL) {
+      GetNameFromHandle ((EFI_HANDLE) Measurement.Handle);
+      UnicodeStrToAsciiStr (mGaugeString, AsciiName);
+    }
+    JsonEscapeString (Name, sizeof (Name), AsciiName);
+
+    if (Measurement.EndTimeStamp != 0) {
+      Duration = DurationInMicroSeconds (GetDuration (&Measurement));
+      AsciiSPrint (
+        Line,
+        DP_EXPORT_LINE_LENGTH,
+        "%a{\"name\":\"%a\",\"cat\":\"%a\",\"ph\":\"X\",\"ts\":%ld,\"dur\":%ld,\"pid\":0,\"tid\":%d,"
+        "\"args\":{\"handle\":\"0x%p\",\"driver\":\"%a\",\"id\":%d}}",
+        (Count == 0) ? "" : ",\n",
+        Token,
+        Module,
+        StartTime,
+        Duration,
+        GetTraceTrack (&Measurement),
+        Measurement.Handle,
+        Name,
+        Measurement.Identifier
+        );
+    } else {
+      AsciiSPrint (
+        Line,
+        DP_EXPORT_LINE_LENGTH,
+        "%a{\"name\":\"%a\",\"cat\":\"%a\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%ld,\"pid\":0,\"tid\":%d,"
+        "\"args\":{\"handle\":\"0x%p\",\"driver\":\"%a\",\"id\":%d}}",
+        (Count == 0) ? "" : ",\n",
+        Token,
+        Module,
+        StartTime,
+        GetTraceTrack (&Measurement),
+        Measurement.Handle,
+        Name,
+        Measurement.Identifier
+        );
+    }
+    Status = WriteAsciiString (FileHandle, Line);
+    ++Count;
+  }
+
+  if (!EFI_ERROR (Status)) {
+    Status = WriteAsciiString (FileHandle, "\n]}\n");
+  }
+  ShellCloseFile (&FileHandle);
+  FreePool (Line);
+
+  if (!EFI_ERROR (Status)) {
+    PrintToken (STRING_TOKEN (STR_DP_EXPORT_DONE), Count, FileName);
+  }
+  return Status;
+}
@@ -354,6 +354,27 @@ DumpRawProfile(
   IN BOOLEAN        ExcludeFlag
   );
 
+/**
+  Export all Trace measurements to a file in Chrome trace JSON format.
+
+  Complete measurements are written as "X" (complete) events with their
+  start time and duration in microseconds.  Measurements without an end
+  time are written as "i" (instant) events.
+
+  @pre    TimerInfo must be initialized.
+          The mGaugeString global array is used for temporary string storage.
+          It must not be in use by a calling function.
+
+  @param[in]    FileName    Name of the file to create.  An existing file is replaced.
+
+  @retval EFI_SUCCESS       All records were written.
+  @retval other             The file could not be created or written.
+**/
+EFI_STATUS
+ExportChromeTrace (
+  IN CONST CHAR16   *FileName
+  );
+
 /**
   Wrap original FreePool to check NULL pointer first.
 
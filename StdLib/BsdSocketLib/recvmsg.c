@@ -0,0 +1,154 @@
+/** @file
+  Implement the recvmsg API.
+
+  Copyright (c) 2026, agent <agent@local>
+  All rights reserved. This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#include <SocketInternals.h>
+
+#include <stdlib.h>
+
+#include <Library/BaseMemoryLib.h>
+
+
+/**
+  Receive a message into a scatter/gather list from a network connection.
+
+  The recvmsg routine waits for receive data from a remote network
+  connection and distributes it across the buffers described by the
+  msg_iov array.  A stream socket with a single element array receives
+  the data directly.  Otherwise the data is received through one
+  intermediate buffer, so that a datagram is read by a single receive
+  operation.  A datagram larger than the total length of the buffers
+  is truncated, the excess bytes are discarded and MSG_TRUNC is set in
+  msg_flags.  Ancillary data is not supported, msg_controllen is set
+  to zero.
+
+  The
+  <a href="http://pubs.opengroup.org/onlinepubs/9699919799/functions/recvmsg.html">POSIX</a>
+  documentation is available online.
+
+  @param [in] s         Socket file descriptor returned from ::socket.
+
+  @param [in, out] message  Address of a msghdr structure describing the
+                            receive buffers and optionally a buffer to
+                            receive the remote system address.
+
+  @param [in] flags     Message control flags
+
+  @return     This routine returns the number of valid bytes received,
+              zero if no data was received, and -1 when an error occurs.
+              In the case of an error, ::errno contains more details.
+
+ **/
+ssize_t
+recvmsg (
+  int s,
+  struct msghdr * message,
+  int flags
+  )
+{
+  BOOLEAN bDatagram;
+  int Index;
+  size_t Length;
+  ssize_t LengthInBytes;
+  UINT8 * pBuffer;
+  UINT8 * pData;
+  socklen_t * pNameLength;
+  size_t Remaining;
+  int Type;
+  socklen_t TypeLength;
+
+  //
+  //  Validate the message
+  //
+  if (( NULL == message )
+    || ( 0 > message->msg_iovlen )
+    || (( 0 < message->msg_iovlen ) && ( NULL == message->msg_iov ))) {
+    errno = EINVAL;
+    return -1;
+  }
+  pNameLength = ( NULL != message->msg_name ) ? &message->msg_namelen : NULL;
+  message->msg_controllen = 0;
+  message->msg_flags = 0;
+
+  //
+  //  Determine if the socket preserves message boundaries
+  //
+  TypeLength = sizeof ( Type );
+  if ( 0 != getsockopt ( s, SOL_SOCKET, SO_TYPE, &Type, &TypeLength )) {
+    return -1;
+  }
+  bDatagram = (BOOLEAN)(( SOCK_DGRAM == Type ) || ( SOCK_RAW == Type ));
+
+  //
+  //  Receive stream data into a single buffer directly
+  //
+  if (( !bDatagram ) && ( 1 == message->msg_iovlen )) {
+    return recvfrom ( s,
+                      message->msg_iov[0].iov_base,
+                      message->msg_iov[0].iov_len,
+                      flags,
+                      message->msg_name,
+                      pNameLength );
+  }
+
+  //
+  //  Determine the total length of the buffers
+  //
+  Length = 0;
+  for ( Index = 0; message->msg_iovlen > Index; Index++ ) {
+    Length += message->msg_iov[ Index ].iov_len;
+  }
+
+  //
+  //  Receive the data into an intermediate buffer.  For a datagram, one
+  //  extra byte detects that the datagram did not fit in the buffers.
+  //
+  pBuffer = malloc ( Length + 1 );
+  if ( NULL == pBuffer ) {
+    errno = ENOMEM;
+    return -1;
+  }
+  LengthInBytes = recvfrom ( s,
+                             pBuffer,
+                             bDatagram ? Length + 1 : Length,
+                             flags,
+                             message->msg_name,
+                             pNameLength );
+  if ( bDatagram && ( (ssize_t)Length < LengthInBytes )) {
+    LengthInBytes = Length;
+    message->msg_flags |= MSG_TRUNC;
+  }
+
+  //
+  //  Scatter the data into the caller's buffers
+  //
+  if ( 0 < LengthInBytes ) {
+    pData = pBuffer;
+    Remaining = LengthInBytes;
+    for ( Index = 0; ( message->msg_iovlen > Index ) && ( 0 < Remaining ); Index++ ) {
+      Length = message->msg_iov[ Index ].iov_len;
+      if ( Length > Remaining ) {
+        Length = Remaining;
+      }
+      CopyMem ( message->msg_iov[ Index ].iov_base, pData, Length );
+      pData += Length;
+      Remaining -= Length;
+    }
+  }
+  free ( pBuffer );
+
+  //
+  //  Return the receive data length, -1 for errors
+  //
+  return LengthInBytes;
+}
@@ -0,0 +1,123 @@
+/** @file
+  Implement the sendmsg API.
+
+  Copyright (c) 2026, agent <agent@local>
+  All rights reserved. This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#include <SocketInternals.h>
+
+#include <stdlib.h>
+
+#include <Library/BaseMemoryLib.h>
+
+
+/**
+  Send a message described by a scatter/gather list using a network connection.
+
+  The sendmsg routine queues the data described by the msg_iov array
+  to the network for transmission.  The data is handed to the socket
+  layer as a single transmit operation, so a SOCK_DGRAM socket sends
+  exactly one datagram.  A single element array is passed through
+  without copying; multiple elements are gathered into one buffer.
+  Ancillary data is not supported and is ignored.
+
+  The
+  <a href="http://pubs.opengroup.org/onlinepubs/9699919799/functions/sendmsg.html">POSIX</a>
+  documentation is available online.
+
+  @param [in] s         Socket file descriptor returned from ::socket.
+
+  @param [in] message   Address of a msghdr structure describing the
+                        data buffers and optionally the remote system
+                        address.
+
+  @param [in] flags     Message control flags
+
+  @return     This routine returns the number of data bytes that were
+              sent and -1 when an error occurs.  In the case of
+              an error, ::errno contains more details.
+
+ **/
+ssize_t
+sendmsg (
+  int s,
+  const struct msghdr * message,
+  int flags
+  )
+{
+  int Index;
+  size_t Length;
+  ssize_t LengthInBytes;
+  UINT8 * pBuffer;
+  UINT8 * pData;
+
+  //
+  //  Validate the message
+  //
+  if (( NULL == message )
+    || ( 0 > message->msg_iovlen )
+    || (( 0 < message->msg_iovlen ) && ( NULL == message->msg_iov ))) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  //
+  //  Send a single buffer directly
+  //
+  if ( 1 >= message->msg_iovlen ) {
+    return sendto ( s,
+                    ( 0 == message->msg_iovlen ) ? NULL : message->msg_iov[0].iov_base,
+                    ( 0 == message->msg_iovlen ) ? 0 : message->msg_iov[0].iov_len,
+                    flags,
+                    message->msg_name,
+                    message->msg_namelen );
+  }
+
+  //
+  //  Determine the total length of the message
+  //
+  Length = 0;
+  for ( Index = 0; message->msg_iovlen > Index; Index++ ) {
+    Length += message->msg_iov[ Index ].iov_len;
+  }
+
+  //
+  //  Gather the data into a single buffer
+  //
+  pBuffer = malloc ( Length + 1 );
+  if ( NULL == pBuffer ) {
+    errno = ENOMEM;
+    return -1;
+  }
+  pData = pBuffer;
+  for ( Index = 0; message->msg_iovlen > Index; Index++ ) {
+    CopyMem ( pData,
+              message->msg_iov[ Index ].iov_base,
+              message->msg_iov[ Index ].iov_len );
+    pData += message->msg_iov[ Index ].iov_len;
+  }
+
+  //
+  //  Send the message
+  //
+  LengthInBytes = sendto ( s,
+                           pBuffer,
+                           Length,
+                           flags,
+                           message->msg_name,
+                           message->msg_namelen );
+  free ( pBuffer );
+
+  //
+  //  Return the number of data bytes sent, -1 for errors
+  //
+  return LengthInBytes;
+}
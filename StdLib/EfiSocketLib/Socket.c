@@ -443,7 +443,9 @@
   the transmit packet (::ESL_PACKET) to an ::ESL_IO_MGMT structure
   and then queues the result to one of the active lists:
   ESL_PORT::pTxActive or ESL_PORT::pTxOobActive.  The routine then
-  hands the packet to the network stack.
+  hands the packet to the network stack.  Packets continue to be handed
+  to the network stack until the queue is empty or all of the
+  ESL_IO_MGMT structures are active.
 
   Upon completion, the network specific TxComplete routine calls
   ::EslSocketTxComplete to disconnect the transmit packet from the
@@ -478,7 +480,7 @@ CONST ESL_SOCKET_BINDING cEslSocketBinding[] = {
     &mEslTcp4ServiceGuid,
     OFFSET_OF ( ESL_LAYER, pTcp4List ),
     4,    //  RX buffers
-    4,    //  TX buffers
+    8,    //  TX buffers
     4 },  //  TX Oob buffers
   { L"Tcp6",
     &gEfiTcp6ServiceBindingProtocolGuid,
@@ -486,7 +488,7 @@ CONST ESL_SOCKET_BINDING cEslSocketBinding[] = {
     &mEslTcp6ServiceGuid,
     OFFSET_OF ( ESL_LAYER, pTcp6List ),
     4,    //  RX buffers
-    4,    //  TX buffers
+    8,    //  TX buffers
     4 },  //  TX Oob buffers
   { L"Udp4",
     &gEfiUdp4ServiceBindingProtocolGuid,
@@ -4359,6 +4361,7 @@ EslSocketReceive (
   } Addr;
   socklen_t AddressLength;
   BOOLEAN bConsumePacket;
+  BOOLEAN bRxRestart;
   BOOLEAN bUrgentQueue;
   size_t DataLength;
   ESL_PACKET * pNextPacket;
@@ -4490,6 +4493,7 @@ EslSocketReceive (
                     //
                     //  Copy the received data
                     //
+                    bRxRestart = FALSE;
                     do {
                       //
                       //  Attempt to receive a packet
@@ -4542,13 +4546,7 @@ EslSocketReceive (
                                   pPort,
                                   pPacket ));
 
-                        //
-                        //  Restart the receive operation if necessary
-                        //
-                        if (( NULL != pPort->pRxFree )
-                          && ( MAX_RX_DATA > pSocket->RxBytes )) {
-                            EslSocketRxStart ( pPort );
-                        }
+                        bRxRestart = TRUE;
                       }
 
                       //
@@ -4559,6 +4557,16 @@ EslSocketReceive (
                           && ( NULL != pPacket )
                           && ( 0 < BufferLength ));
 
+                    //
+                    //  Restart the receive operations once all of the
+                    //  consumed packets are back on the free list
+                    //
+                    if ( bRxRestart
+                      && ( NULL != pPort->pRxFree )
+                      && ( MAX_RX_DATA > pSocket->RxBytes )) {
+                      EslSocketRxStart ( pPort );
+                    }
+
                     //
                     //  Successful operation
                     //
@@ -5622,7 +5630,10 @@ EslSocketTxComplete (
   underlying network layer.
 
   The network specific code calls this routine to start a
-  transmit operation.  See the \ref TransmitEngine section.
+  transmit operation.  Queued packets are handed to the network
+  layer until either the queue is empty or all of the transmit
+  tokens are in use, keeping the transmit pipeline full.  See the
+  \ref TransmitEngine section.
 
   @param[in]  pPort           Address of an ::ESL_PORT structure
   @param[in]  ppQueueHead     Transmit queue head address
@@ -5659,7 +5670,7 @@ EslSocketTxStart (
   //
   pPacket = *ppQueueHead;
   pIo = *ppFree;
-  if (( NULL != pPacket ) && ( NULL != pIo )) {
+  while (( NULL != pPacket ) && ( NULL != pIo ) && ( !EFI_ERROR ( Status ))) {
     pSocket = pPort->pSocket;
     //
     //     *ppQueueHead: pSocket->pRxPacketListHead or pSocket->pRxOobPacketListHead
@@ -5789,6 +5800,12 @@ EslSocketTxStart (
       //
       EslSocketPacketFree ( pPacket, DEBUG_TX );
     }
+
+    //
+    //  Get the next packet and IO structure
+    //
+    pPacket = *ppQueueHead;
+    pIo = *ppFree;
   }
 
   DBG_EXIT ( );